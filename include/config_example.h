@@ -6,4 +6,7 @@
 #define WEATHER_URL "https://api.openweathermap.org/data/2.5/weather?units=metric&mode=json&lat=51.50&lon=0.00&appid=api-key-here"
 #define FORECAST_URL "https://api.openweathermap.org/data/2.5/forecast?units=metric&mode=json&cnt=24&lat=51.50&lon=0.00&appid=api-key-here"
 #define DAILY_FORECAST_URL "https://api.openweathermap.org/data/2.5/forecast/daily?units=metric&mode=json&cnt=7&lat=51.50&lon=0.00&appid=api-key-here"
-#define LOCATION "London"
\ No newline at end of file
+#define LOCATION "London"
+  // pegelonline.wsv.de station uuids, one string literal each (up to 4), see https://www.pegelonline.wsv.de/webservices/rest-api/v2/stations.json
+  // e.g. two stations: #define WATER_STATIONS "66ff3eb4-513b-478b-abd2-2f5126ea66fd", "aa9179c1-17ef-4c61-a48a-74193fa7bfdf"
+#define WATER_STATIONS "66ff3eb4-513b-478b-abd2-2f5126ea66fd"
\ No newline at end of file
@@ -0,0 +1,54 @@
+/* CountingCanvas is a TextCanvas that counts the drawing primitives issued against it, so the cost of a render
+    can be measured without a logic analyser on the SPI bus. Higher level Adafruit_GFX calls (circles, triangles,
+    text) end up in the counted primitives below, a drawLine() that is horizontal or vertical is also counted as
+    the span it turns into. Only used when RENDER_STATS is true, normal builds render into a plain TextCanvas.
+*/
+
+#pragma once
+
+#include "textCanvas.h"
+
+class CountingCanvas : public TextCanvas {
+public:
+  uint32_t pixels;      // drawPixel() calls
+  uint32_t spans;       // drawFastHLine() and drawFastVLine() calls
+  uint32_t lines;       // drawLine() calls
+  uint32_t rects;       // fillRect() calls
+  uint32_t chars;       // characters written, or glyphs drawn by drawText()
+
+  CountingCanvas(uint16_t w, uint16_t h) : TextCanvas(w, h) { resetCounts(); }
+
+  void resetCounts() { pixels = spans = lines = rects = chars = 0; }
+  uint32_t primitives() const { return pixels + spans + lines + rects + chars; }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    pixels++;
+    GFXcanvas1::drawPixel(x, y, color);
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+    spans++;
+    GFXcanvas1::drawFastHLine(x, y, w, color);
+  }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+    spans++;
+    GFXcanvas1::drawFastVLine(x, y, h, color);
+  }
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override {
+    lines++;
+    GFXcanvas1::drawLine(x0, y0, x1, y1, color);
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+    rects++;
+    GFXcanvas1::fillRect(x, y, w, h, color);
+  }
+  size_t write(uint8_t c) override {
+    chars++;
+    return GFXcanvas1::write(c);
+  }
+
+protected:
+  void drawGlyph(int16_t x, int16_t y, uint8_t c) override {
+    chars++;
+    TextCanvas::drawGlyph(x, y, c);
+  }
+};
@@ -0,0 +1,80 @@
+/* Fixed-point sine/cosine for the drawing helpers. The compass, sun rays and snow flakes only ever use the 16
+    compass points (22.5 degree steps, the 45 degree steps are every second entry), arrows are rotated by whole
+    degrees. Values are scaled by TRIG_ONE, multiply with trigMul() so the result is truncated like the float
+    to int conversion it replaces.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+const int TRIG_ONE = 1 << 14;       // 1.0 in the tables below
+
+  // sin() of the 16 compass points, index 0 = N, 4 = E, 8 = S, 12 = W
+constexpr int16_t compass_sin[16] = {
+    0, 6270, 11585, 15137, 16384, 15137, 11585, 6270,
+    0, -6270, -11585, -15137, -16384, -15137, -11585, -6270
+};
+
+  // sin() of 0..90 degrees in 1 degree steps, the other quadrants are mirrored
+constexpr int16_t quarter_sin[91] = {
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384
+};
+
+/* compassSin(), compassCos()
+  Parameters:
+    int point: compass point, 0 = N, 1 = NNE ... 15 = NNW, wraps around
+  Returns:
+    int: sin/cos of the point's bearing, scaled by TRIG_ONE
+*/
+constexpr int compassSin(int point) { return compass_sin[point & 15]; }
+constexpr int compassCos(int point) { return compass_sin[(point + 4) & 15]; }
+
+/* degSin(), degCos()
+  Parameters:
+    int deg: angle in degrees, any value
+  Returns:
+    int: sin/cos of the angle, scaled by TRIG_ONE
+*/
+inline int degSin(int deg) {
+  deg %= 360;
+  if (deg < 0)
+    deg += 360;
+  if (deg <= 90)
+    return quarter_sin[deg];
+  if (deg <= 180)
+    return quarter_sin[180 - deg];
+  if (deg <= 270)
+    return -quarter_sin[deg - 180];
+  return -quarter_sin[360 - deg];
+}
+inline int degCos(int deg) { return degSin(deg + 90); }
+
+/* trigMul()
+  Returns:
+    int: v times the fixed-point factor f, truncated towards zero
+*/
+constexpr int trigMul(int v, int f) { return v * f / TRIG_ONE; }
+
+/* rotate()
+    Rotate a point around the origin, clockwise on the screen (y points down).
+  Parameters:
+    int x, y: point to rotate
+    int deg: angle in degrees
+    int &rx, &ry: rotated point
+*/
+inline void rotate(int x, int y, int deg, int &rx, int &ry) {
+  int s = degSin(deg);
+  int c = degCos(deg);
+  rx = (x * c - y * s) / TRIG_ONE;
+  ry = (y * c + x * s) / TRIG_ONE;
+}
@@ -0,0 +1,125 @@
+/* gzip bodies for the GzipStream tests of [env:native] (test_gzip, test_forecast_replay), made with Python's
+    gzip.compress(body, 9, mtime=0):
+    gzip_forecast_fixture: an OpenWeatherMap forecast (cnt=24) as the API sends it, 9722 bytes inflated
+    gzip_window_fixture: 39278 bytes of repeated list entries, longer than the 32 KB window so it wraps
+*/
+
+#pragma once
+
+const uint32_t gzip_forecast_inflated = 9722;
+const uint32_t gzip_window_inflated = 39278;
+
+const uint8_t gzip_forecast_fixture[1514] = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xCD, 0x9A, 0x4F, 0x6F, 0xDB, 0x38,
+  0x10, 0xC5, 0xBF, 0x4A, 0xA0, 0xB3, 0x2B, 0x70, 0x86, 0xE4, 0x90, 0xF4, 0xB1, 0x97, 0xBD, 0xEC,
+  0x69, 0xAF, 0x8B, 0x45, 0xE0, 0x8D, 0xD5, 0x44, 0xA8, 0xFF, 0xC1, 0xB2, 0xBB, 0xED, 0x06, 0xFD,
+  0xEE, 0x4B, 0x2A, 0x96, 0x14, 0x91, 0x23, 0x55, 0x86, 0x61, 0x6D, 0x80, 0x02, 0x49, 0x65, 0x45,
+  0xA6, 0xF4, 0xF3, 0x9B, 0x37, 0x6F, 0xE8, 0xD7, 0xEC, 0x69, 0xBF, 0xCE, 0x96, 0x19, 0x0A, 0x91,
+  0x2D, 0xB2, 0x6D, 0x51, 0x55, 0xAB, 0xE7, 0x22, 0x5B, 0x8A, 0x45, 0xF6, 0xB4, 0x3B, 0x65, 0x4B,
+  0x54, 0x8B, 0x6C, 0x53, 0x56, 0xFE, 0xB7, 0x3F, 0x5F, 0xB3, 0xB5, 0xFF, 0x01, 0x06, 0xB5, 0x73,
+  0xE0, 0x4F, 0xF7, 0x67, 0xAF, 0xCA, 0x5D, 0xB6, 0x7C, 0xCD, 0x4E, 0xC5, 0xF6, 0xE0, 0x5F, 0xA1,
+  0xDC, 0xF9, 0xB3, 0xBF, 0x14, 0xC5, 0xA6, 0x7A, 0xDC, 0x94, 0x5F, 0xFD, 0x55, 0x40, 0xE7, 0xC6,
+  0x1F, 0x0A, 0xAF, 0x3F, 0x6E, 0xC3, 0xB9, 0xFE, 0x1C, 0xD5, 0x1E, 0x58, 0x7D, 0x0F, 0x97, 0xCB,
+  0xA5, 0x3F, 0x70, 0x38, 0xFA, 0x37, 0x3E, 0x1F, 0xC3, 0x9F, 0x08, 0xF0, 0x57, 0xAE, 0x8A, 0xD5,
+  0xE3, 0xA6, 0xF8, 0x56, 0x6C, 0xEA, 0x03, 0xB8, 0xC8, 0x9E, 0x8F, 0xBB, 0x75, 0x73, 0xC4, 0x11,
+  0x2C, 0xB2, 0x97, 0xF3, 0xB6, 0x5C, 0x97, 0xA7, 0x1F, 0xD9, 0xD2, 0x8A, 0xCB, 0x05, 0xBF, 0x7E,
+  0xF1, 0xEB, 0xFE, 0xB9, 0xC8, 0xFE, 0x29, 0x56, 0xA7, 0x97, 0xE2, 0x58, 0x2F, 0xB9, 0xF4, 0xF7,
+  0xA6, 0xBB, 0xB5, 0x66, 0x7F, 0x84, 0x1F, 0x8B, 0x6C, 0x5D, 0x54, 0x4F, 0xC7, 0xF2, 0x70, 0x2A,
+  0xF7, 0xE1, 0xE0, 0xA6, 0x7C, 0x7E, 0x39, 0x3D, 0x1C, 0xDF, 0x5E, 0x2A, 0x9F, 0xEA, 0x63, 0x20,
+  0xD6, 0xD9, 0xCF, 0xBF, 0xFC, 0x53, 0xD8, 0xEC, 0xCF, 0xEB, 0x2A, 0xDC, 0xE5, 0x6A, 0x13, 0xDE,
+  0x3B, 0x5C, 0xBF, 0xDC, 0xAD, 0xC3, 0x81, 0xEA, 0x50, 0x14, 0xFE, 0x17, 0x95, 0x3B, 0x19, 0xAE,
+  0xF8, 0xEC, 0x7F, 0xB5, 0x7E, 0xA5, 0xE7, 0xF0, 0xB4, 0x64, 0x8E, 0xE1, 0xD4, 0x6F, 0x65, 0x55,
+  0xFE, 0x5D, 0x6E, 0xEA, 0x75, 0x82, 0x10, 0x61, 0x21, 0x87, 0xBD, 0x7F, 0x56, 0x22, 0x17, 0xE4,
+  0xEF, 0xF2, 0x47, 0x7D, 0xE1, 0x43, 0x0D, 0x60, 0x97, 0xF9, 0xF3, 0xD7, 0xA7, 0xC7, 0xD3, 0xF7,
+  0x53, 0x8D, 0x03, 0xD5, 0x27, 0xE1, 0x3E, 0x81, 0x78, 0x00, 0xBB, 0x14, 0xC2, 0xFF, 0xF3, 0xAF,
+  0xB7, 0x08, 0x48, 0x08, 0x14, 0x0C, 0x02, 0x9D, 0x23, 0x46, 0x08, 0x54, 0x2E, 0xB0, 0x87, 0x40,
+  0xE5, 0x06, 0x7B, 0x08, 0x74, 0x4E, 0x18, 0x21, 0x50, 0x57, 0x22, 0x80, 0x19, 0x11, 0x48, 0x91,
+  0x32, 0x10, 0xB9, 0x56, 0x17, 0x06, 0x08, 0xA6, 0x81, 0xE0, 0x8F, 0xCA, 0x51, 0x08, 0xDA, 0x44,
+  0x10, 0xD6, 0x43, 0x10, 0x10, 0x38, 0x08, 0x80, 0x96, 0x81, 0x60, 0x73, 0x63, 0x23, 0x08, 0x26,
+  0xD7, 0xB6, 0x07, 0xC1, 0xE6, 0x68, 0x7B, 0x10, 0x5C, 0x0E, 0xB6, 0x0F, 0x41, 0xD8, 0xEB, 0x20,
+  0xB8, 0x3B, 0x41, 0xD8, 0x71, 0x10, 0x34, 0x0B, 0xA1, 0xD1, 0x01, 0x80, 0xEC, 0x18, 0x28, 0x1C,
+  0x65, 0x60, 0x27, 0x0A, 0x01, 0x1E, 0x6A, 0x00, 0xCB, 0xBA, 0x4E, 0x1D, 0x2F, 0x4F, 0x5C, 0xBE,
+  0x84, 0x4B, 0x78, 0xA9, 0xF5, 0xB0, 0xA0, 0x24, 0x56, 0x1B, 0x06, 0x12, 0x6D, 0x68, 0xE8, 0x61,
+  0xF1, 0xFA, 0x81, 0x1E, 0x16, 0xCA, 0x01, 0x22, 0x6D, 0xE0, 0x95, 0x58, 0xEE, 0x52, 0x9E, 0x84,
+  0x62, 0xB5, 0x01, 0x32, 0xC5, 0x22, 0x73, 0xE5, 0x2E, 0x5C, 0x24, 0xB6, 0xDA, 0x80, 0x9C, 0xC6,
+  0x0B, 0x14, 0x4C, 0x93, 0x86, 0xC7, 0x22, 0x39, 0x69, 0x48, 0xA5, 0x58, 0x69, 0x48, 0x97, 0x48,
+  0x03, 0x5C, 0x8F, 0x81, 0xC9, 0xAD, 0xEB, 0x31, 0xF0, 0x7A, 0x72, 0x11, 0x03, 0xB8, 0xB2, 0x3E,
+  0xD1, 0x9C, 0xD2, 0x50, 0x9C, 0x47, 0x10, 0x35, 0xF5, 0x49, 0xB6, 0x26, 0xE1, 0x3F, 0x6D, 0x66,
+  0x94, 0x81, 0xD2, 0x93, 0xB5, 0x41, 0xAC, 0x36, 0x20, 0xD7, 0x91, 0x36, 0x94, 0xE6, 0xAC, 0xDB,
+  0xD5, 0x10, 0x22, 0x2E, 0xCE, 0x45, 0x25, 0x8B, 0x5C, 0x54, 0xB2, 0xF4, 0x8D, 0x5C, 0x48, 0xCC,
+  0xC8, 0x45, 0x5A, 0x4E, 0x1B, 0xA0, 0x9B, 0x9A, 0x65, 0x74, 0xC3, 0x85, 0xBC, 0x31, 0x8C, 0x72,
+  0x41, 0x37, 0x59, 0x1C, 0x8E, 0x13, 0x87, 0x26, 0x71, 0xC7, 0x02, 0x75, 0xA5, 0x79, 0x93, 0xBE,
+  0x4B, 0x81, 0x92, 0x2C, 0x04, 0x60, 0x1A, 0x28, 0xDF, 0x7F, 0xB4, 0xDE, 0xAD, 0x3B, 0xDF, 0x90,
+  0x7A, 0x94, 0x01, 0x99, 0xA9, 0xDA, 0x00, 0xE4, 0x18, 0x10, 0xF1, 0xDE, 0xAD, 0x54, 0x22, 0x04,
+  0x54, 0x51, 0x81, 0x72, 0x2A, 0x2A, 0x50, 0x36, 0xEE, 0x61, 0xE5, 0x75, 0x0C, 0x0C, 0xCD, 0xC8,
+  0xC0, 0x50, 0xCA, 0x00, 0x73, 0x67, 0xDB, 0x02, 0xF5, 0xCE, 0xBC, 0x69, 0xDC, 0xBC, 0xC5, 0x64,
+  0x21, 0x80, 0x1E, 0x28, 0x50, 0x32, 0x2A, 0x50, 0xC6, 0xF0, 0xE6, 0x9D, 0x18, 0x87, 0x8A, 0x8D,
+  0x43, 0xC5, 0xC6, 0xA1, 0x53, 0xE3, 0xC0, 0x8F, 0xD0, 0x53, 0x09, 0xE0, 0x0B, 0x14, 0x71, 0xC6,
+  0xD1, 0xF4, 0x54, 0x52, 0x61, 0x17, 0x2E, 0x60, 0x1C, 0x4B, 0xF8, 0x7C, 0x4E, 0xD4, 0x86, 0x1D,
+  0xC0, 0x82, 0xD8, 0xC7, 0x62, 0x2D, 0xE7, 0xE7, 0x5E, 0x0A, 0x14, 0x61, 0xA1, 0xBC, 0xFD, 0x30,
+  0x37, 0x72, 0x51, 0x14, 0xC9, 0x45, 0xD2, 0x6D, 0xBE, 0x61, 0xE4, 0x8C, 0x3D, 0x95, 0x63, 0xFC,
+  0x1C, 0xBA, 0x9E, 0xAA, 0xB6, 0xD3, 0x37, 0x2E, 0xBE, 0xA9, 0x1F, 0xAF, 0x59, 0x7A, 0xAA, 0x5A,
+  0xDA, 0xB8, 0x11, 0xB7, 0xBA, 0xB6, 0x4F, 0xC5, 0x39, 0x3E, 0x88, 0x87, 0xE2, 0x18, 0x05, 0x71,
+  0x65, 0xA2, 0x20, 0x0E, 0x26, 0x0A, 0xE2, 0xC2, 0xDC, 0x18, 0xC4, 0x71, 0x4E, 0x37, 0xD7, 0x9C,
+  0x58, 0xB0, 0x49, 0x81, 0x60, 0x65, 0xE7, 0xE6, 0xA0, 0x46, 0xA9, 0x84, 0x86, 0x6C, 0x8A, 0x5A,
+  0x70, 0x38, 0x81, 0x80, 0xE9, 0x71, 0x81, 0xCB, 0x1B, 0x24, 0x45, 0xCC, 0xA5, 0x06, 0x6F, 0x62,
+  0x83, 0x57, 0xB1, 0xC1, 0x4B, 0xB8, 0x4D, 0x2D, 0x5A, 0xCF, 0x58, 0xC4, 0x8C, 0xE6, 0xD4, 0x22,
+  0x1A, 0xB5, 0x40, 0xB0, 0xD7, 0xC6, 0x5C, 0xC4, 0x38, 0x97, 0x50, 0xF0, 0xA6, 0xC8, 0x05, 0xBB,
+  0x08, 0x12, 0x57, 0x31, 0x9F, 0x87, 0x7A, 0x5C, 0x50, 0x30, 0xA6, 0x8F, 0xA2, 0x9E, 0x88, 0xF4,
+  0xB8, 0xF8, 0xDE, 0xB6, 0x37, 0x35, 0xF1, 0xE7, 0x60, 0x6F, 0x6A, 0x82, 0xFE, 0xE2, 0xF1, 0xD4,
+  0x84, 0xAE, 0x34, 0x17, 0x35, 0xE3, 0xD4, 0x44, 0x5B, 0xAE, 0xF1, 0x52, 0xAD, 0xB9, 0xB4, 0xA1,
+  0xC4, 0xE7, 0x31, 0x3B, 0x2E, 0x17, 0x37, 0x59, 0x2E, 0x34, 0x14, 0xD8, 0xA1, 0x8F, 0x45, 0x02,
+  0xB1, 0xBD, 0x98, 0x85, 0xA4, 0x17, 0x23, 0x88, 0x42, 0x89, 0x84, 0x28, 0x94, 0x20, 0xDC, 0x36,
+  0x47, 0x21, 0x33, 0x23, 0x16, 0x64, 0x7B, 0x31, 0x6A, 0xB8, 0x68, 0xEA, 0x3C, 0x5F, 0xD0, 0x78,
+  0x2B, 0xA6, 0x27, 0xAB, 0xC5, 0x0D, 0x60, 0x89, 0xC4, 0xA2, 0x50, 0xB1, 0x45, 0x8C, 0xD2, 0x22,
+  0xA6, 0xE2, 0x22, 0x06, 0x71, 0x11, 0x13, 0x70, 0x5B, 0x87, 0x3C, 0xAB, 0x58, 0xD8, 0x90, 0x82,
+  0x4D, 0x52, 0x94, 0xA0, 0x3A, 0x2A, 0x72, 0x7C, 0x8A, 0x42, 0x72, 0xAA, 0x58, 0xD8, 0x94, 0x02,
+  0x5A, 0x22, 0xAB, 0x0C, 0x4A, 0x95, 0xA1, 0x62, 0x65, 0x40, 0xAC, 0x8C, 0x84, 0x81, 0xBE, 0x52,
+  0x19, 0x38, 0x23, 0x83, 0x3A, 0x79, 0x24, 0x10, 0x1C, 0x33, 0x46, 0xF1, 0x3D, 0xF2, 0x78, 0x3B,
+  0x2C, 0x61, 0xAA, 0x34, 0x06, 0x53, 0x8A, 0xEE, 0x4B, 0x83, 0x94, 0x60, 0xA7, 0x28, 0x49, 0x78,
+  0xB4, 0x71, 0x78, 0xB4, 0x71, 0x78, 0x74, 0x69, 0x78, 0xD4, 0x1F, 0x21, 0xC0, 0x0F, 0xF4, 0x5D,
+  0xC8, 0xD9, 0x3B, 0x36, 0x21, 0x05, 0x8D, 0x78, 0xB7, 0x03, 0x32, 0x5E, 0xB0, 0x68, 0xB2, 0x8F,
+  0xB0, 0x3B, 0x20, 0x60, 0x94, 0x65, 0x19, 0x84, 0x76, 0x27, 0x62, 0x20, 0x75, 0x8F, 0x81, 0xAB,
+  0x8B, 0x65, 0x8F, 0x81, 0xD3, 0xB7, 0x05, 0xC5, 0xFB, 0x4C, 0xB2, 0x06, 0x02, 0x3C, 0xB1, 0xA6,
+  0x81, 0x17, 0x06, 0x56, 0xBF, 0x43, 0x30, 0x3E, 0xC6, 0x9A, 0xDC, 0x60, 0xB1, 0xDB, 0x1F, 0x60,
+  0x35, 0x6F, 0xDB, 0x02, 0x93, 0x4C, 0x68, 0x31, 0xCA, 0x84, 0x1A, 0xA3, 0x4C, 0xA8, 0xF0, 0xB6,
+  0x2E, 0xF7, 0x3E, 0x06, 0x31, 0x90, 0x09, 0xB9, 0x3D, 0x28, 0x55, 0x77, 0xF7, 0x97, 0xFD, 0x0F,
+  0xEA, 0xE6, 0xEC, 0xE3, 0xDD, 0x94, 0x9A, 0xA8, 0x02, 0xD9, 0x85, 0x8F, 0x1E, 0x03, 0x47, 0x8A,
+  0xED, 0x68, 0x93, 0xAD, 0x58, 0x17, 0x6D, 0xC5, 0xFA, 0x73, 0xFA, 0x5B, 0xB1, 0xBE, 0xA3, 0x4D,
+  0xB6, 0x62, 0xAF, 0x54, 0x81, 0x9D, 0x73, 0x94, 0x88, 0xEC, 0x9C, 0x1D, 0xA8, 0x9D, 0xE7, 0x52,
+  0x67, 0x10, 0x42, 0x5E, 0x37, 0x2F, 0x59, 0x0F, 0x42, 0xE0, 0x36, 0x3B, 0x50, 0x18, 0xE4, 0x63,
+  0x85, 0x4C, 0x63, 0x85, 0x8C, 0x63, 0x85, 0x8C, 0x63, 0x85, 0xBC, 0xAD, 0x53, 0xA2, 0xFF, 0x7B,
+  0xC3, 0x09, 0xEA, 0xF9, 0xCE, 0x1B, 0x04, 0xF1, 0xCE, 0x0F, 0x7E, 0x15, 0xF7, 0xEC, 0x64, 0x25,
+  0x10, 0x07, 0x01, 0xAC, 0xE0, 0x5B, 0x25, 0x4A, 0x5B, 0x25, 0x8A, 0x5B, 0x25, 0x8A, 0x5B, 0x25,
+  0xBA, 0x2D, 0x44, 0xCC, 0xAA, 0x04, 0x8B, 0xEC, 0x8E, 0x78, 0x53, 0x8D, 0x64, 0xD7, 0x2A, 0xF9,
+  0x24, 0x7E, 0x65, 0xB8, 0x1B, 0x56, 0x02, 0xB7, 0xB3, 0x81, 0x68, 0x2D, 0x3B, 0x90, 0xC2, 0x64,
+  0x1E, 0x25, 0xA2, 0xC4, 0x60, 0xA2, 0xC0, 0x40, 0x1F, 0x71, 0x18, 0x35, 0xB4, 0xAB, 0x01, 0x5C,
+  0x29, 0x6A, 0x07, 0xEA, 0x02, 0xBB, 0x4A, 0x04, 0xE3, 0x3B, 0x4B, 0x46, 0x4D, 0x15, 0x41, 0x9B,
+  0x17, 0x92, 0x14, 0xD7, 0x9F, 0xDC, 0xA2, 0x74, 0xC4, 0x3B, 0x04, 0xA5, 0x0E, 0x41, 0xB1, 0x43,
+  0x50, 0xEC, 0x10, 0x37, 0xEA, 0x82, 0xD4, 0x9C, 0x3B, 0xB1, 0xEC, 0xB7, 0x75, 0x6C, 0x13, 0xAE,
+  0x8D, 0xEA, 0x36, 0x62, 0x7F, 0xB1, 0xD7, 0x34, 0x55, 0x14, 0x6D, 0x7E, 0xA8, 0x57, 0x53, 0x5F,
+  0xE9, 0xED, 0xB6, 0x90, 0x94, 0x34, 0xCA, 0x57, 0xF2, 0xDD, 0x6A, 0xEB, 0x1F, 0x5C, 0xF6, 0xFB,
+  0x7E, 0xB7, 0xDE, 0x87, 0x3B, 0x78, 0xDA, 0xEF, 0x8F, 0xF5, 0xFA, 0x36, 0xAB, 0xB0, 0x10, 0x08,
+  0x33, 0xE2, 0x4D, 0xB8, 0xA9, 0xF0, 0x70, 0x9E, 0xF6, 0xE7, 0xDD, 0xE9, 0xE8, 0x2F, 0x92, 0xFD,
+  0xF6, 0x39, 0xAB, 0x57, 0x73, 0xF6, 0xA7, 0xD5, 0xCF, 0xA1, 0x5E, 0x60, 0x58, 0xE2, 0xA9, 0xDC,
+  0x16, 0xFF, 0xEE, 0x77, 0x45, 0xD8, 0x3F, 0x08, 0xFF, 0xAF, 0xCE, 0xBB, 0x63, 0x59, 0x15, 0x97,
+  0x6F, 0x6A, 0x29, 0xDF, 0xA5, 0x99, 0xFA, 0x60, 0x55, 0xB4, 0xDF, 0xDE, 0xF2, 0x22, 0xF5, 0x51,
+  0xFF, 0x3F, 0x51, 0x19, 0x6D, 0x0B, 0xFA, 0x25, 0x00, 0x00,
+};
+
+const uint8_t gzip_window_fixture[223] = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0xCB, 0x3B, 0x0A, 0x83, 0x40,
+  0x18, 0x85, 0xD1, 0xBD, 0xFC, 0xF5, 0x10, 0x54, 0xF2, 0x40, 0xB7, 0x12, 0x52, 0x04, 0xB5, 0x10,
+  0x62, 0x22, 0x6A, 0xAA, 0xC1, 0xBD, 0x67, 0xF6, 0x91, 0x53, 0x5D, 0xB8, 0x1F, 0x27, 0x47, 0xFF,
+  0x19, 0xA2, 0x8B, 0xA6, 0xAA, 0x22, 0xC5, 0x6B, 0xDA, 0xF6, 0xE8, 0xEE, 0x39, 0x86, 0x32, 0xF5,
+  0xAD, 0xB9, 0xB4, 0x6D, 0x5D, 0x4A, 0x8A, 0xF9, 0x39, 0xBD, 0xA3, 0xCB, 0xB1, 0x8F, 0xF3, 0x52,
+  0xCA, 0xF5, 0xD4, 0x9E, 0x53, 0x2C, 0xEB, 0xB8, 0x6D, 0xDF, 0x75, 0x2C, 0x47, 0x55, 0x37, 0xC7,
+  0x91, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3,
+  0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38,
+  0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E,
+  0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3,
+  0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38,
+  0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E,
+  0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3,
+  0x38, 0x8E, 0xFB, 0x3B, 0xF7, 0x38, 0x7E, 0x2D, 0x97, 0x61, 0xF5, 0x6E, 0x99, 0x00, 0x00,
+};
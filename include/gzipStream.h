@@ -0,0 +1,53 @@
+/* The GzipStream library (consisting of gzipStream.h and gzipStream.cpp) inflates a gzip encoded stream (e.g. the
+    body of an HttpsSession response sent with Content-Encoding: gzip) as it is read, so it can be handed straight
+    to deserializeJson() like the stream it wraps. It uses the inflater in the ESP32 ROM. The 32 KB window and the
+    inflater state are allocated by reserve() or the first begin() and reused by every stream inflated after that.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <rom/miniz.h>
+
+class GzipStream : public Stream {
+public:
+  uint32_t inflated;    // bytes inflated from the current stream so far
+    // see gzipStream.cpp for documentation of the following class methods
+  GzipStream();
+  ~GzipStream();
+  bool reserve();
+  bool begin(Stream *in);
+  bool finish();
+    // Stream interface, reads the inflated data
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t write(uint8_t) override { return 0; };
+
+private:
+  static const size_t INPUT_SIZE = 256;     // compressed bytes read from the wrapped stream at a time
+
+  typedef struct Buffers {
+    tinfl_decompressor inflator;
+    uint8_t window[TINFL_LZ_DICT_SIZE];     // inflated data, the last 32 KB are what back references point into
+  } Buffers;
+
+  Stream *in;           // compressed stream, NULL = not started
+  Buffers *buffers;     // allocated once, NULL = not yet
+  uint8_t input[INPUT_SIZE];  // compressed data not yet consumed
+  size_t inPos;
+  size_t inLen;
+  bool inputDone;       // the wrapped stream has ended
+  size_t outPos;        // next inflated byte to hand out, in window
+  size_t outEnd;        // end of the inflated bytes not yet handed out
+  size_t windowPos;     // where the inflater writes next, wraps around
+  tinfl_status status;  // of the last tinfl_decompress() call
+  bool failed;          // the stream isn't valid gzip (or its trailer didn't match)
+  uint32_t crc;         // crc32 of the inflated data, as in the gzip trailer
+
+  bool fillInput();
+  int inputByte();
+  bool readHeader();
+  bool inflateMore();
+  bool checkTrailer();
+};
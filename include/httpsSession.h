@@ -0,0 +1,98 @@
+/* The HttpsSession library (consisting of httpsSession.h and httpsSession.cpp) implements a small HTTP/1.1 client
+    on top of mbedTLS that keeps the connection to a host open between requests. Requests can be pipelined
+    (several sent before the first response is read), responses with a Content-Length or a chunked body are
+    supported and the body of the current response is read through the Stream interface, so it can be handed
+    straight to deserializeJson(). The TLS session can be saved in a TlsSessionCache (e.g. in RTC memory) so
+    the next connection to the host resumes it instead of doing a full handshake. Requests can be made
+    conditional on the ETag/Last-Modified of an earlier response (kept in an HttpValidator), and a crc32 of
+    each body is taken as it is read, for servers that send neither. Bodies can be asked for gzip encoded
+    (acceptGzip()), they are then read through a GzipStream.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/net_sockets.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+
+  // Room for a saved session. With MBEDTLS_SSL_KEEP_PEER_CERTIFICATE (the ESP-IDF default) a saved session holds
+  // the DER of the server certificate besides the session fields and ticket. A session that doesn't fit isn't
+  // saved, TlsSessionCache.needed tells how much room it wanted and the host does a full handshake every time.
+const size_t TLS_SESSION_BYTES = 1536;
+
+  // Saved TLS session of a host, plain data so it can be kept in RTC memory across deep sleep
+typedef struct TlsSessionCache {
+  uint16_t len;         // bytes used in data, 0 = no session saved
+  uint16_t needed;      // bytes the last session needed when it didn't fit in data, 0 = it did
+  uint16_t resumed;     // handshakes that resumed the saved session
+  uint16_t full;        // full handshakes
+  uint8_t data[TLS_SESSION_BYTES];  // session as written by mbedtls_ssl_session_save()
+} TlsSessionCache;
+
+  // Validators of a response, plain data so it can be kept in RTC memory across deep sleep
+typedef struct HttpValidator {
+  char etag[48];          // ETag header, "" = none (or too long to keep)
+  char lastModified[32];  // Last-Modified header, "" = none
+  uint32_t bodyCrc;       // crc32 of the body, 0 = unknown
+} HttpValidator;
+
+class HttpsSession : public Stream {
+public:
+  int status;           // status code of the current response, 0 if none
+  time_t date;          // Date header of the current response as unix time, 0 if none
+  uint32_t received;    // bytes received over the connection(s) so far, headers and bodies, after decryption
+  HttpValidator validator;  // validators of the current response, bodyCrc covers the body read so far
+  bool gzipped;         // the body of the current response is gzip encoded
+  static const uint8_t MAX_PENDING = 4;     // max number of pipelined requests
+    // see httpsSession.cpp for documentation of the following class methods
+  HttpsSession(const char *host, TlsSessionCache *session = NULL, uint16_t port = 443);
+  ~HttpsSession();
+  bool send(const char *path, const HttpValidator *conditional = NULL);
+  bool response();
+  bool get(const char *path);
+  void acceptGzip(bool accept);
+  void finish();
+  void stop();
+    // Stream interface, reads the body of the current response
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t write(uint8_t) override { return 0; };
+
+private:
+  static const uint32_t TIMEOUT = 5000;     // ms to wait for data from the server
+  static const size_t RX_SIZE = 512;        // bytes decrypted per read from the connection
+
+  const char *host;
+  uint16_t port;
+  TlsSessionCache *session;   // where the TLS session is loaded from and saved to, NULL = don't
+  bool open;                  // TLS contexts are set up and the connection is open
+  mbedtls_net_context net;
+  mbedtls_ssl_context ssl;
+  mbedtls_ssl_config conf;
+  mbedtls_entropy_context entropy;
+  mbedtls_ctr_drbg_context drbg;
+  uint8_t rx[RX_SIZE];        // decrypted data not yet consumed
+  size_t rxPos;
+  size_t rxLen;
+
+  const char *pending[MAX_PENDING];   // paths of the requests sent but not yet answered, oldest first
+  const HttpValidator *conditions[MAX_PENDING];   // validators the pending requests were sent with, NULL = none
+  uint8_t numPending;
+  bool gzipAccepted;    // requests say the body may be gzip encoded
+  bool keepAlive;       // server keeps the connection open after the current response
+  bool chunked;         // current response uses chunked transfer encoding
+  bool bodyDone;        // all of the current body has been read
+  long remaining;       // bytes left in the current body (or chunk), -1 = until the connection closes
+  int peeked;           // byte returned by peek() but not yet by read(), -1 = none
+
+  bool connect();
+  bool handshake(bool resume);
+  void close();
+  bool writeRequest(const char *path, const HttpValidator *conditional);
+  int clientRead();
+  bool readLine(char *line, size_t size);
+  bool nextChunk();
+};
@@ -0,0 +1,911 @@
+#pragma once
+
+/***************************************************************************************
+** Description:   weather icon atlas, generated by the [env:icon-atlas] build, do not edit
+***************************************************************************************/
+static_assert(ICON_COUNT == 20, "icon atlas is out of date, regenerate it with [env:icon-atlas]");
+const unsigned char ICON_small_01d[] PROGMEM = {
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x10, 0x08, 0x04, 0x00, 0x08, 0x08, 0x08, 0x00, 0x04, 0x08, 0x10, 0x00, 0x02, 0x1f, 0x20, 0x00,
+  0x01, 0x3f, 0xc0, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xf0, 0x00,
+  0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xf0, 0x00,
+  0x00, 0xff, 0xe0, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x01, 0x3f, 0xc0, 0x00, 0x02, 0x1f, 0x20, 0x00,
+  0x04, 0x08, 0x10, 0x00, 0x08, 0x08, 0x08, 0x00, 0x10, 0x08, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+};
+const unsigned char ICON_small_01n[] PROGMEM = {
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x41, 0x04, 0x00, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x00, 0x11, 0xd0, 0x00,
+  0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0x80, 0x00,
+  0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x00, 0x11, 0xd0, 0x00, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x00, 0x41,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+};
+const unsigned char ICON_small_02d[] PROGMEM = {
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x04, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00,
+  0x11, 0xd0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0xff, 0xff, 0x80, 0x00,
+  0x0f, 0xf8, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x07, 0xf0, 0x38, 0x00, 0x0f, 0xf0, 0x44, 0x00,
+  0x11, 0xd7, 0x82, 0x00, 0x21, 0x0d, 0x82, 0x00, 0x41, 0x70, 0x01, 0x00, 0x01, 0xd0, 0x01, 0x80,
+  0x01, 0x80, 0x00, 0x80, 0x00, 0xd0, 0x01, 0x80, 0x00, 0x7f, 0xff, 0x00,
+};
+const unsigned char ICON_small_02n[] PROGMEM = {
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x07, 0x82, 0x00,
+  0x00, 0x00, 0x0d, 0x82, 0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x80, 0x00,
+  0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xd0, 0x01, 0x80, 0x00, 0x00, 0x7f, 0xff, 0x00,
+};
+const unsigned char ICON_small_03d[] PROGMEM = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x41, 0x04, 0x00, 0x00, 0x00, 0x21,
+  0x08, 0x0f, 0x80, 0x00, 0x11, 0xd0, 0x30, 0x60, 0x00, 0x0f, 0xf0, 0x60, 0x30, 0x00, 0x07, 0xf0,
+  0xc0, 0x18, 0x00, 0xff, 0xff, 0x80, 0x08, 0x00, 0x0f, 0xe3, 0x00, 0x04, 0x00, 0x0f, 0x80, 0x00,
+  0x04, 0x00, 0x07, 0x80, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x04,
+  0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+  0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x01, 0x00, 0x60,
+  0x00, 0x00, 0x03, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00,
+};
+const unsigned char ICON_small_03n[] PROGMEM = {
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x70, 0x00, 0x00, 0x30, 0x60, 0x00,
+  0x18, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x3e, 0x80,
+  0x08, 0x00, 0x00, 0x00, 0x63, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x80, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00,
+};
+const unsigned char ICON_small_04d[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x07, 0x82, 0x00, 0x00,
+  0x1c, 0x0f, 0x82, 0x00, 0x00, 0x22, 0x70, 0x61, 0x00, 0x03, 0xc1, 0xe0, 0x31, 0x80, 0x06, 0xc1,
+  0xc0, 0x18, 0x80, 0x38, 0x3e, 0x80, 0x09, 0x80, 0x68, 0x63, 0x00, 0x07, 0x00, 0x40, 0x80, 0x00,
+  0x04, 0x00, 0x69, 0x80, 0x00, 0x04, 0x00, 0x3f, 0x00, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x04,
+  0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+  0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x01, 0x00, 0x60,
+  0x00, 0x00, 0x03, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00,
+};
+const unsigned char ICON_small_04n[] PROGMEM = {
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x38, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x44, 0x00, 0xe0, 0x00,
+  0x00, 0x07, 0x82, 0x00, 0x60, 0x00, 0x1c, 0x0f, 0x82, 0x00, 0x70, 0x00, 0x22, 0x70, 0x61, 0x00,
+  0x18, 0x03, 0xc1, 0xe0, 0x31, 0x80, 0x00, 0x06, 0xc1, 0xc0, 0x18, 0x80, 0x00, 0x38, 0x3e, 0x80,
+  0x09, 0x80, 0x00, 0x68, 0x63, 0x00, 0x07, 0x00, 0x00, 0x40, 0x80, 0x00, 0x04, 0x00, 0x00, 0x69,
+  0x80, 0x00, 0x04, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00,
+};
+const unsigned char ICON_small_09d[] PROGMEM = {
+  0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x82, 0x00, 0x00, 0x00, 0x10,
+  0x84, 0x07, 0xc0, 0x00, 0x08, 0xe8, 0x18, 0x30, 0x00, 0x07, 0xf8, 0x30, 0x18, 0x00, 0x03, 0xf8,
+  0x60, 0x0c, 0x00, 0x7f, 0xff, 0xc0, 0x04, 0x00, 0x07, 0xf1, 0x80, 0x02, 0x00, 0x07, 0xc0, 0x00,
+  0x02, 0x00, 0x03, 0xc0, 0x00, 0x02, 0x00, 0x07, 0x80, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x00, 0x02,
+  0x00, 0x30, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x40,
+  0x40, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x40, 0x20, 0x00, 0x00, 0x00, 0x80, 0x30,
+  0x00, 0x00, 0x01, 0x80, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x84, 0x21, 0x04, 0x00, 0x31, 0x8c, 0x63, 0x0c, 0x00, 0x73, 0x9c, 0xe7,
+  0x1c, 0x00, 0xe7, 0x39, 0xce, 0x38, 0x00, 0x42, 0x10, 0x84, 0x10, 0x00,
+};
+const unsigned char ICON_small_09n[] PROGMEM = {
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x70, 0x00, 0x00, 0x30, 0x60, 0x00,
+  0x18, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x3e, 0x80,
+  0x08, 0x00, 0x00, 0x00, 0x63, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x80, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x42,
+  0x08, 0x00, 0x00, 0x63, 0x18, 0xc6, 0x18, 0x00, 0x00, 0xe7, 0x39, 0xce, 0x38, 0x00, 0x01, 0xce,
+  0x73, 0x9c, 0x70, 0x00, 0x00, 0x84, 0x21, 0x08, 0x20, 0x00,
+};
+const unsigned char ICON_small_10d[] PROGMEM = {
+  0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00,
+  0x00, 0x60, 0x0c, 0x00, 0x00, 0x1f, 0x40, 0x04, 0x00, 0x00, 0x31, 0x80, 0x02, 0x00, 0x00, 0x40,
+  0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x00,
+  0x02, 0x00, 0x30, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00,
+  0x40, 0x40, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x40, 0x20, 0x00, 0x00, 0x00, 0x80,
+  0x30, 0x00, 0x00, 0x01, 0x80, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x21, 0x04, 0x00, 0x31, 0x8c, 0x63, 0x0c, 0x00, 0x73, 0x9c,
+  0xe7, 0x1c, 0x00, 0xe7, 0x39, 0xce, 0x38, 0x00, 0x42, 0x10, 0x84, 0x10, 0x00,
+};
+const unsigned char ICON_small_11d[] PROGMEM = {
+  0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00,
+  0x00, 0xc0, 0x18, 0x00, 0x00, 0x3e, 0x80, 0x08, 0x00, 0x00, 0x63, 0x00, 0x04, 0x00, 0x00, 0x80,
+  0x00, 0x04, 0x00, 0x01, 0x80, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00,
+  0x04, 0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x01, 0x00,
+  0x60, 0x00, 0x00, 0x03, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+  0x82, 0x08, 0x20, 0x00, 0x41, 0x04, 0x10, 0x40, 0x00, 0xfb, 0xef, 0xbe, 0xf8, 0x00, 0x08, 0x41,
+  0x04, 0x10, 0x00, 0x10, 0x41, 0x08, 0x20, 0x00, 0x10, 0x82, 0x10, 0x40, 0x00, 0x21, 0x04, 0x20,
+  0x80, 0x00,
+};
+const unsigned char ICON_small_11n[] PROGMEM = {
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x70, 0x00, 0x00, 0x30, 0x60, 0x00,
+  0x18, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x3e, 0x80,
+  0x08, 0x00, 0x00, 0x00, 0x63, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x80, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x82, 0x08, 0x20, 0x00, 0x00, 0x41, 0x04, 0x10,
+  0x40, 0x00, 0x00, 0xfb, 0xef, 0xbe, 0xf8, 0x00, 0x00, 0x08, 0x41, 0x04, 0x10, 0x00, 0x00, 0x10,
+  0x41, 0x08, 0x20, 0x00, 0x00, 0x10, 0x82, 0x10, 0x40, 0x00, 0x00, 0x21, 0x04, 0x20, 0x80, 0x00,
+};
+const unsigned char ICON_small_13d[] PROGMEM = {
+  0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00,
+  0x00, 0xc0, 0x18, 0x00, 0x00, 0x3e, 0x80, 0x08, 0x00, 0x00, 0x63, 0x00, 0x04, 0x00, 0x00, 0x80,
+  0x00, 0x04, 0x00, 0x01, 0x80, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00,
+  0x04, 0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x01, 0x00,
+  0x60, 0x00, 0x00, 0x03, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x20, 0x82, 0x08, 0x00, 0x1c, 0x71, 0xc7, 0x1c, 0x00, 0x3e, 0xfb, 0xef, 0xbe, 0x00, 0x1c, 0x71,
+  0xc7, 0x1c, 0x00, 0x08, 0x20, 0x82, 0x08, 0x00,
+};
+const unsigned char ICON_small_13n[] PROGMEM = {
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x70, 0x00, 0x00, 0x30, 0x60, 0x00,
+  0x18, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x3e, 0x80,
+  0x08, 0x00, 0x00, 0x00, 0x63, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0x80, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x82, 0x08, 0x00, 0x00, 0x1c, 0x71, 0xc7,
+  0x1c, 0x00, 0x00, 0x3e, 0xfb, 0xef, 0xbe, 0x00, 0x00, 0x1c, 0x71, 0xc7, 0x1c, 0x00, 0x00, 0x08,
+  0x20, 0x82, 0x08, 0x00,
+};
+const unsigned char ICON_small_50d[] PROGMEM = {
+  0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7f, 0xf8,
+};
+const unsigned char ICON_small_50n[] PROGMEM = {
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x70, 0x00, 0x03, 0xff, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xf8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc0,
+};
+const unsigned char ICON_large_01d[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xe0, 0x00,
+  0x01, 0xc0, 0x00, 0x00, 0x38, 0x00, 0x00, 0xe0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x1c, 0x00, 0x00,
+  0xe0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0xe0, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0xe0, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0xf8, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1f, 0xff,
+  0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x7f, 0xff, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xfc, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,
+  0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xe0, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x8f,
+  0xff, 0xe0, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xff, 0xff,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xfc,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
+  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x7f, 0xff, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1f, 0xff, 0x03, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x70, 0x03, 0xf8, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe0,
+  0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0xe0, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0xe0, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0xe0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0xe0, 0x00, 0x01, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00,
+};
+const unsigned char ICON_large_01n[] PROGMEM = {
+  0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00,
+  0x03, 0x80, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03,
+  0x80, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x0f, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3f, 0xf9, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xe7, 0xff, 0xff, 0xcf, 0xfc, 0x00, 0x00, 0x00, 0x7f, 0xe7, 0xff, 0xff, 0xcf,
+  0xfc, 0x00, 0x00, 0x00, 0x7f, 0xe7, 0xff, 0xff, 0xcf, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
+  0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3f, 0xf9,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0f, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
+};
+const unsigned char ICON_large_02d[] PROGMEM = {
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07,
+  0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x07, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x70,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x38, 0x00, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x07, 0xff, 0x00, 0x00, 0x1c, 0x1f, 0xc1, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x8f, 0x80, 0x00,
+  0x0e, 0x7f, 0xf3, 0x80, 0x00, 0x00, 0x03, 0xee, 0x03, 0x80, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00,
+  0x00, 0x07, 0xfe, 0x03, 0xc0, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x0f, 0xfc, 0x01, 0xc0,
+  0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x1e, 0x3c, 0x01, 0xc0, 0x00, 0x07, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x1c, 0x1c, 0x01, 0xc0, 0x00, 0x07, 0xff, 0xff, 0x00, 0x00, 0x01, 0xfc, 0x1e, 0x03,
+  0xc0, 0x00, 0x0f, 0xff, 0xff, 0x80, 0x00, 0x07, 0xfc, 0x1e, 0x03, 0xf0, 0x00, 0x0f, 0xff, 0xff,
+  0x80, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x70, 0xff, 0xcf, 0xff, 0xff, 0x9f, 0xf8, 0x0f, 0x40, 0x00,
+  0x00, 0x78, 0xff, 0xcf, 0xff, 0xff, 0x9f, 0xf8, 0x0e, 0x00, 0x00, 0x00, 0x38, 0xff, 0xcf, 0xff,
+  0xff, 0x9f, 0xf8, 0x0f, 0x40, 0x00, 0x00, 0x78, 0x00, 0x0f, 0xff, 0x8f, 0x80, 0x00, 0x07, 0xff,
+  0xff, 0xff, 0xf0, 0x00, 0x0f, 0xfe, 0x03, 0x80, 0x00, 0x07, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x07,
+  0xfe, 0x03, 0xc0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xfc, 0x01, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3c, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x1c, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x1e, 0x03, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x1e, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xc0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x40, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff,
+  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const unsigned char ICON_large_02n[] PROGMEM = {
+  0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xfc, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xdc, 0x07, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xfc, 0x07, 0x80, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x03, 0x80,
+  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x78, 0x03, 0x80, 0x1f, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x03, 0x80, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xf8, 0x3c, 0x07, 0x80, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x3c, 0x07, 0xe0,
+  0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x01,
+  0xf0, 0x00, 0x00, 0x1e, 0x80, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x1c,
+  0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x1e, 0x80, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xdc,
+  0x07, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x0f, 0xfc, 0x07, 0x80, 0x00, 0x03,
+  0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xf8, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3c, 0x78, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38,
+  0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x3c, 0x07, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x3c, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x80, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x80, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x80, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff,
+  0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+};
+const unsigned char ICON_large_03d[] PROGMEM = {
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07,
+  0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x07, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+  0x00, 0x00, 0x70, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xe0, 0x00, 0x7f,
+  0xfc, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0xc1, 0xc0, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x7f, 0xf3, 0x80, 0x07, 0xf0, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x0f,
+  0x80, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0x00, 0x03, 0xff, 0xff, 0xc0, 0x3c, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xf8,
+  0x78, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xfc, 0x70, 0x00, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x0f, 0xff, 0xe0, 0x3f, 0xf0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80,
+  0x0f, 0xe0, 0x00, 0x00, 0x0e, 0x00, 0x00, 0xff, 0xcf, 0xff, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0xff, 0xcf, 0xfc, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xcf, 0xfc,
+  0x00, 0x01, 0xc0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x03, 0x80, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x07,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
+  0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xc0, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
+  0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x78,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00,
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+  0x00,
+};
+const unsigned char ICON_large_03n[] PROGMEM = {
+  0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xf8, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x3f, 0x80, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x07, 0xc0, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x78, 0x00, 0x00, 0xf0, 0x00, 0x1f, 0x80, 0x00, 0x01, 0xff,
+  0xf0, 0xf0, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x80, 0x00, 0x03, 0xff, 0xf8, 0xe0, 0x00, 0x00, 0x38,
+  0x00, 0x07, 0xc0, 0x00, 0x0f, 0xc0, 0x7f, 0xe0, 0x00, 0x00, 0x3c, 0x00, 0x01, 0xe0, 0x00, 0x1f,
+  0x00, 0x1f, 0xc0, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x0f, 0x80, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0,
+  0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
+  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x80,
+};
+const unsigned char ICON_large_04d[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xf8, 0x00, 0x00, 0x00, 0x7f, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x00,
+  0xff, 0xc0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x01, 0xe3, 0xc0, 0x1c, 0x00,
+  0x00, 0x00, 0x00, 0x3e, 0x0f, 0x80, 0x00, 0x01, 0xc1, 0xc0, 0x1c, 0x00, 0x00, 0x00, 0xf8, 0x78,
+  0x03, 0xc0, 0x00, 0x1f, 0xc1, 0xe0, 0x3c, 0x00, 0x00, 0x03, 0xfe, 0xf0, 0x01, 0xe0, 0x01, 0xff,
+  0xc1, 0xe0, 0x3f, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x00, 0xe0, 0x07, 0xff, 0xc0, 0x00, 0x07, 0x00,
+  0x00, 0x0f, 0x07, 0xe0, 0x00, 0xf0, 0x1f, 0xff, 0xf0, 0x00, 0x07, 0x80, 0x00, 0x1e, 0x03, 0xc0,
+  0x00, 0x70, 0x7f, 0x01, 0xfc, 0x00, 0x03, 0x80, 0x00, 0x1c, 0x01, 0xc0, 0x00, 0x70, 0xf8, 0x00,
+  0x3e, 0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0xc0, 0x00, 0x71, 0xf0, 0x00, 0x1f, 0xff, 0xff, 0x00,
+  0x00, 0x38, 0x00, 0xc1, 0xfc, 0x73, 0xc0, 0x00, 0x07, 0xff, 0xff, 0x00, 0x0f, 0xf8, 0x00, 0xcf,
+  0xff, 0xff, 0x80, 0x00, 0x03, 0xff, 0xfc, 0x00, 0x1f, 0xf8, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,
+  0x01, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x7e, 0x03, 0xff, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0xf8, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xf0, 0x00, 0x01, 0xf0,
+  0x00, 0x7c, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xe0, 0x00, 0x01, 0xc0, 0x00, 0x1c, 0x00, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0xe0, 0x00, 0x03, 0xc0, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0xe0, 0x00, 0x07, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xf0, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x1f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3c, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xe0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x38, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x07, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x7f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfc, 0x00, 0x00,
+};
+const unsigned char ICON_large_04n[] PROGMEM = {
+  0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xfc, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xdc, 0x07, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x0f, 0xfc, 0x07, 0x80, 0x7f, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x00, 0x1f, 0xf8, 0x03, 0x80,
+  0x3f, 0x00, 0x00, 0x03, 0xff, 0xe0, 0x00, 0x00, 0x3c, 0x78, 0x03, 0x80, 0x1f, 0x80, 0x00, 0x07,
+  0xc1, 0xf0, 0x00, 0x00, 0x38, 0x38, 0x03, 0x80, 0x0f, 0x80, 0x1f, 0x0f, 0x00, 0x78, 0x00, 0x03,
+  0xf8, 0x3c, 0x07, 0x80, 0x07, 0xc0, 0x7f, 0xde, 0x00, 0x3c, 0x00, 0x3f, 0xf8, 0x3c, 0x07, 0xe0,
+  0x01, 0xe0, 0xff, 0xfc, 0x00, 0x1c, 0x00, 0xff, 0xf8, 0x00, 0x00, 0xe0, 0x00, 0x01, 0xe0, 0xfc,
+  0x00, 0x1e, 0x03, 0xff, 0xfe, 0x00, 0x00, 0xf0, 0x00, 0x03, 0xc0, 0x78, 0x00, 0x0e, 0x0f, 0xe0,
+  0x3f, 0x80, 0x00, 0x70, 0x00, 0x03, 0x80, 0x38, 0x00, 0x0e, 0x1f, 0x00, 0x07, 0xc0, 0x00, 0xf0,
+  0x00, 0x07, 0x00, 0x18, 0x00, 0x0e, 0x3e, 0x00, 0x03, 0xff, 0xff, 0xe0, 0x00, 0x07, 0x00, 0x18,
+  0x3f, 0x8e, 0x78, 0x00, 0x00, 0xff, 0xff, 0xe0, 0x01, 0xff, 0x00, 0x19, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x7f, 0xff, 0x80, 0x03, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x07, 0xe0, 0x00, 0x0f, 0xc0, 0x7f, 0xe0, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1f,
+  0x00, 0x1f, 0xc0, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x3e, 0x00, 0x0f, 0x80, 0x00,
+  0x00, 0x0e, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x78, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1c, 0x00, 0x00, 0xf0,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1e, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x07, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
+  0x00, 0x0f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x1f, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,
+  0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xe0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
+};
+const unsigned char ICON_large_09d[] PROGMEM = {
+  0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+  0xe0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0x00, 0x00, 0x0e, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1c, 0x00, 0x0f,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x03, 0x83, 0xf8, 0x38, 0x00, 0x3f, 0xff, 0xe0, 0x00, 0x00, 0x00,
+  0x01, 0xcf, 0xfe, 0x70, 0x00, 0xfe, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x01,
+  0xf0, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x80, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xff, 0xf8, 0x07, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x01, 0xff, 0xfc, 0x07, 0xfe, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x01, 0xff, 0xf0,
+  0x01, 0xfc, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x1f, 0xf9, 0xff, 0xe0, 0x00, 0xf8, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x1f, 0xf9, 0xff, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x1f, 0xf9, 0xff,
+  0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00,
+  0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80,
+  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00,
+  0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0c, 0x00,
+  0x60, 0x00, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x00, 0x07, 0x80, 0x3c,
+  0x01, 0xe0, 0x0f, 0x00, 0x78, 0x03, 0xc0, 0x00, 0x3f, 0x81, 0xfc, 0x0f, 0xe0, 0x7f, 0x03, 0xf8,
+  0x1f, 0xc0, 0x00, 0x7f, 0x83, 0xfc, 0x1f, 0xe0, 0xff, 0x07, 0xf8, 0x3f, 0xc0, 0x00, 0xff, 0x07,
+  0xf8, 0x3f, 0xc1, 0xfe, 0x0f, 0xf0, 0x7f, 0x80, 0x00, 0xff, 0x07, 0xf8, 0x3f, 0xc1, 0xfe, 0x0f,
+  0xf0, 0x7f, 0x80, 0x00, 0xff, 0x07, 0xf8, 0x3f, 0xc1, 0xfe, 0x0f, 0xf0, 0x7f, 0x80, 0x00, 0x7e,
+  0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x00, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70,
+  0x03, 0x80, 0x1c, 0x00, 0x00,
+};
+const unsigned char ICON_large_09n[] PROGMEM = {
+  0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xf8, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x3f, 0x80, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x07, 0xc0, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x78, 0x00, 0x00, 0xf0, 0x00, 0x1f, 0x80, 0x00, 0x01, 0xff,
+  0xf0, 0xf0, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x80, 0x00, 0x03, 0xff, 0xf8, 0xe0, 0x00, 0x00, 0x38,
+  0x00, 0x07, 0xc0, 0x00, 0x0f, 0xc0, 0x7f, 0xe0, 0x00, 0x00, 0x3c, 0x00, 0x01, 0xe0, 0x00, 0x1f,
+  0x00, 0x1f, 0xc0, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x0f, 0x80, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0,
+  0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
+  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20,
+  0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xc0,
+  0x06, 0x00, 0x00, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x00, 0x78, 0x03,
+  0xc0, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x3c, 0x00, 0x03, 0xf8, 0x1f, 0xc0, 0xfe, 0x07, 0xf0, 0x3f,
+  0x81, 0xfc, 0x00, 0x07, 0xf8, 0x3f, 0xc1, 0xfe, 0x0f, 0xf0, 0x7f, 0x83, 0xfc, 0x00, 0x0f, 0xf0,
+  0x7f, 0x83, 0xfc, 0x1f, 0xe0, 0xff, 0x07, 0xf8, 0x00, 0x0f, 0xf0, 0x7f, 0x83, 0xfc, 0x1f, 0xe0,
+  0xff, 0x07, 0xf8, 0x00, 0x0f, 0xf0, 0x7f, 0x83, 0xfc, 0x1f, 0xe0, 0xff, 0x07, 0xf8, 0x00, 0x07,
+  0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x00, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07,
+  0x00, 0x38, 0x01, 0xc0, 0x00,
+};
+const unsigned char ICON_large_10d[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xf0, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x3e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x07, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0xff, 0x0f, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x8e, 0x00, 0x00,
+  0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x07, 0xfe, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00,
+  0x01, 0xf0, 0x01, 0xfc, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0xf8, 0x00,
+  0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+  0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3f, 0xfc, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x03, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x07, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x30, 0x01, 0x80,
+  0x0c, 0x00, 0x60, 0x00, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x00, 0x07,
+  0x80, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x78, 0x03, 0xc0, 0x00, 0x3f, 0x81, 0xfc, 0x0f, 0xe0, 0x7f,
+  0x03, 0xf8, 0x1f, 0xc0, 0x00, 0x7f, 0x83, 0xfc, 0x1f, 0xe0, 0xff, 0x07, 0xf8, 0x3f, 0xc0, 0x00,
+  0xff, 0x07, 0xf8, 0x3f, 0xc1, 0xfe, 0x0f, 0xf0, 0x7f, 0x80, 0x00, 0xff, 0x07, 0xf8, 0x3f, 0xc1,
+  0xfe, 0x0f, 0xf0, 0x7f, 0x80, 0x00, 0xff, 0x07, 0xf8, 0x3f, 0xc1, 0xfe, 0x0f, 0xf0, 0x7f, 0x80,
+  0x00, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x00, 0x00, 0x38, 0x01, 0xc0, 0x0e,
+  0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0x00,
+};
+const unsigned char ICON_large_11d[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x80, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x3c, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xf8, 0x78, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x70, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x3f, 0xf0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x80, 0x0f, 0xe0, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x07, 0xc0, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x3c, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x80,
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xff, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1e, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00,
+  0x70, 0x00, 0xe0, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x00, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0,
+  0x03, 0x80, 0x07, 0x00, 0x00, 0x00, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xe7, 0xff, 0xcf, 0xff, 0x80,
+  0x00, 0xff, 0xf9, 0xff, 0xe3, 0xff, 0xc7, 0xff, 0x8f, 0xff, 0x00, 0x00, 0xff, 0xf1, 0xff, 0xe3,
+  0xff, 0xc7, 0xff, 0x0f, 0xfe, 0x00, 0x00, 0x00, 0x70, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x1c,
+  0x00, 0x00, 0x00, 0xe0, 0x01, 0xc0, 0x07, 0x00, 0x0e, 0x00, 0x38, 0x00, 0x00, 0x00, 0xe0, 0x03,
+  0x80, 0x07, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x00, 0x01, 0xc0, 0x07, 0x00, 0x0e, 0x00, 0x38, 0x00,
+  0x70, 0x00, 0x00, 0x01, 0xc0, 0x07, 0x00, 0x1c, 0x00, 0x70, 0x00, 0xe0, 0x00, 0x00, 0x03, 0x80,
+  0x0e, 0x00, 0x38, 0x00, 0x70, 0x01, 0xc0, 0x00, 0x00, 0x03, 0x80, 0x0e, 0x00, 0x38, 0x00, 0xe0,
+  0x03, 0x80, 0x00, 0x00, 0x07, 0x00, 0x1c, 0x00, 0x70, 0x01, 0xc0, 0x07, 0x00, 0x00, 0x00,
+};
+const unsigned char ICON_large_11n[] PROGMEM = {
+  0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xf8, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x3f, 0x80, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x07, 0xc0, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x78, 0x00, 0x00, 0xf0, 0x00, 0x1f, 0x80, 0x00, 0x01, 0xff,
+  0xf0, 0xf0, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x80, 0x00, 0x03, 0xff, 0xf8, 0xe0, 0x00, 0x00, 0x38,
+  0x00, 0x07, 0xc0, 0x00, 0x0f, 0xc0, 0x7f, 0xe0, 0x00, 0x00, 0x3c, 0x00, 0x01, 0xe0, 0x00, 0x1f,
+  0x00, 0x1f, 0xc0, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x0f, 0x80, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0,
+  0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
+  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0,
+  0x01, 0xc0, 0x00, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x00, 0x00, 0x70,
+  0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07,
+  0x00, 0x0e, 0x00, 0x00, 0x01, 0xff, 0xf3, 0xff, 0xe7, 0xff, 0xcf, 0xff, 0x9f, 0xff, 0x00, 0x01,
+  0xff, 0xf3, 0xff, 0xc7, 0xff, 0x8f, 0xff, 0x1f, 0xfe, 0x00, 0x01, 0xff, 0xe3, 0xff, 0xc7, 0xff,
+  0x8f, 0xfe, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x38, 0x00,
+  0x00, 0x01, 0xc0, 0x03, 0x80, 0x0e, 0x00, 0x1c, 0x00, 0x70, 0x00, 0x00, 0x01, 0xc0, 0x07, 0x00,
+  0x0e, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00, 0x03, 0x80, 0x0e, 0x00, 0x1c, 0x00, 0x70, 0x00, 0xe0,
+  0x00, 0x00, 0x03, 0x80, 0x0e, 0x00, 0x38, 0x00, 0xe0, 0x01, 0xc0, 0x00, 0x00, 0x07, 0x00, 0x1c,
+  0x00, 0x70, 0x00, 0xe0, 0x03, 0x80, 0x00, 0x00, 0x07, 0x00, 0x1c, 0x00, 0x70, 0x01, 0xc0, 0x07,
+  0x00, 0x00, 0x00, 0x0e, 0x00, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x00, 0x00,
+};
+const unsigned char ICON_large_13d[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x80, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x3c, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xf8, 0x78, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x70, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x3f, 0xf0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x80, 0x0f, 0xe0, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x07, 0xc0, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x3c, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x80,
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xff, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1e, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x40, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80,
+  0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x24, 0x02, 0x48, 0x04, 0x90, 0x09, 0x20, 0x12, 0x40, 0x00,
+  0x00, 0xa8, 0x01, 0x50, 0x02, 0xa0, 0x05, 0x40, 0x0a, 0x80, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01,
+  0xc0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x07, 0xff, 0x0f, 0xfe, 0x1f, 0xfc, 0x3f, 0xf8, 0x7f, 0xf0,
+  0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x50,
+  0x02, 0xa0, 0x05, 0x40, 0x0a, 0x80, 0x00, 0x01, 0x24, 0x02, 0x48, 0x04, 0x90, 0x09, 0x20, 0x12,
+  0x40, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x40, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x00,
+};
+const unsigned char ICON_large_13n[] PROGMEM = {
+  0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xf8, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x3f, 0x80, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x07, 0xc0, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x78, 0x00, 0x00, 0xf0, 0x00, 0x1f, 0x80, 0x00, 0x01, 0xff,
+  0xf0, 0xf0, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x80, 0x00, 0x03, 0xff, 0xf8, 0xe0, 0x00, 0x00, 0x38,
+  0x00, 0x07, 0xc0, 0x00, 0x0f, 0xc0, 0x7f, 0xe0, 0x00, 0x00, 0x3c, 0x00, 0x01, 0xe0, 0x00, 0x1f,
+  0x00, 0x1f, 0xc0, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x0f, 0x80, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0,
+  0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
+  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x80, 0x01, 0x00, 0x02,
+  0x00, 0x04, 0x00, 0x00, 0x02, 0x48, 0x04, 0x90, 0x09, 0x20, 0x12, 0x40, 0x24, 0x80, 0x00, 0x01,
+  0x50, 0x02, 0xa0, 0x05, 0x40, 0x0a, 0x80, 0x15, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80,
+  0x07, 0x00, 0x0e, 0x00, 0x00, 0x0f, 0xfe, 0x1f, 0xfc, 0x3f, 0xf8, 0x7f, 0xf0, 0xff, 0xe0, 0x00,
+  0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x01, 0x50, 0x02, 0xa0, 0x05,
+  0x40, 0x0a, 0x80, 0x15, 0x00, 0x00, 0x02, 0x48, 0x04, 0x90, 0x09, 0x20, 0x12, 0x40, 0x24, 0x80,
+  0x00, 0x00, 0x40, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x80,
+  0x01, 0x00, 0x02, 0x00, 0x04, 0x00,
+};
+const unsigned char ICON_large_50d[] PROGMEM = {
+  0x00, 0x01, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
+  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
+};
+const unsigned char ICON_large_50n[] PROGMEM = {
+  0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0xfe, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc,
+  0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xf8, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x1f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff,
+  0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff,
+  0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc,
+  0x00, 0x00,
+};
+
+const icon_bitmap icon_atlas[2][ICON_COUNT] PROGMEM = {
+  { // small
+    {NULL, 0, 0, 0, 0}, // none
+    {NULL, 0, 0, 0, 0}, // unused
+    {ICON_small_01d, -13, -13, 27, 27}, // 01d
+    {ICON_small_01n, -24, -19, 33, 28}, // 01n
+    {ICON_small_02d, -16, -16, 25, 19}, // 02d
+    {ICON_small_02n, -24, -19, 33, 22}, // 02n
+    {ICON_small_03d, -16, -16, 33, 21}, // 03d
+    {ICON_small_03n, -24, -19, 41, 24}, // 03n
+    {ICON_small_04d, -16, -16, 33, 21}, // 04d
+    {ICON_small_04n, -24, -19, 41, 24}, // 04n
+    {ICON_small_09d, -17, -16, 34, 28}, // 09d
+    {ICON_small_09n, -24, -19, 41, 31}, // 09n
+    {ICON_small_10d, -17, -13, 34, 25}, // 10d
+    {ICON_small_09n, -24, -19, 41, 31}, // 10n
+    {ICON_small_11d, -16, -13, 33, 26}, // 11d
+    {ICON_small_11n, -24, -19, 41, 32}, // 11n
+    {ICON_small_13d, -16, -13, 33, 24}, // 13d
+    {ICON_small_13n, -24, -19, 41, 30}, // 13n
+    {ICON_small_50d, -11, -12, 24, 17}, // 50d
+    {ICON_small_50n, -24, -19, 37, 24}, // 50n
+  },
+  { // large
+    {NULL, 0, 0, 0, 0}, // none
+    {NULL, 0, 0, 0, 0}, // unused
+    {ICON_large_01d, -33, -33, 67, 67}, // 01d
+    {ICON_large_01n, -47, -40, 70, 63}, // 01n
+    {ICON_large_02d, -40, -30, 85, 45}, // 02d
+    {ICON_large_02n, -47, -30, 92, 39}, // 02n
+    {ICON_large_03d, -40, -36, 81, 51}, // 03d
+    {ICON_large_03n, -47, -36, 88, 51}, // 03n
+    {ICON_large_04d, -44, -31, 89, 51}, // 04d
+    {ICON_large_04n, -47, -40, 92, 60}, // 04n
+    {ICON_large_09d, -43, -40, 84, 63}, // 09d
+    {ICON_large_09n, -47, -40, 88, 63}, // 09n
+    {ICON_large_10d, -43, -30, 84, 53}, // 10d
+    {ICON_large_09n, -47, -40, 88, 63}, // 10n
+    {ICON_large_11d, -40, -30, 81, 61}, // 11d
+    {ICON_large_11n, -47, -40, 88, 71}, // 11n
+    {ICON_large_13d, -40, -30, 81, 56}, // 13d
+    {ICON_large_13n, -47, -40, 88, 66}, // 13n
+    {ICON_large_50d, -30, -30, 60, 43}, // 50d
+    {ICON_large_50n, -47, -40, 77, 53}, // 50n
+  },
+};
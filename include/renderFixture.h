@@ -0,0 +1,35 @@
+/* Render check matrix of the host build (RENDER_FIXTURE, [env:native]). Every case starts from the fixture data
+    and changes one thing, test/test_render renders each one and compares it with its reference image. The
+    functions are in main.cpp, next to the fixture they change.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+enum render_case_kind : uint8_t {
+  CASE_INFO,          // displayInformation() of the fixture as is
+  CASE_ICON,          // current weather icon = value
+  CASE_COLD,          // temperatures below zero
+  CASE_WIND,          // wind from value degrees
+  CASE_BATTERY,       // battery at value mV
+  CASE_ERROR,         // displayErrorMessage()
+  CASE_WIFI_ERROR     // displayWifiErrorMessage() with the battery at value mV
+};
+
+typedef struct RenderCase {
+  render_case_kind kind;
+  int16_t value;
+} RenderCase;
+
+typedef struct RenderResult {
+  const uint8_t *frame;   // the rendered frame, 1 bit per pixel, rows of whole bytes, 1 = white
+  uint32_t primitives;    // draw primitives issued
+  uint32_t us;            // time the render took
+} RenderResult;
+
+const int RENDER_CASE_MAX = 64;
+
+  // see main.cpp for documentation of the following functions
+int buildRenderCases(RenderCase *cases);
+RenderResult renderCase(const RenderCase &c);
@@ -0,0 +1,54 @@
+/* The TextCanvas library (consisting of textCanvas.h and textCanvas.cpp) extends GFXcanvas1 with text measurement
+    that works on const char* and reads only the glyph metrics of the current font, instead of running the full
+    getTextBounds() layout, and with drawText(), which lays out, aligns and draws a line of text in one walk over its
+    glyphs. The sizes of recently measured strings can be kept in a TextWidthCache (e.g. in RTC memory), so labels
+    that are drawn on every render are measured once and then only drawn.
+*/
+
+#pragma once
+
+#include <Adafruit_GFX.h>
+
+const uint8_t TEXT_CACHE_ENTRIES = 32;  // strings remembered, a power of 2
+const uint8_t TEXT_LAYOUT_MAX = 64;     // longest string drawText() lays out itself, longer ones go through print()
+
+  // Which point of the text drawText() puts at x
+enum TextAlign : uint8_t {
+  TEXT_LEFT,
+  TEXT_RIGHT,
+  TEXT_CENTER
+};
+
+  // Sizes of recently measured strings, plain data so it can be kept in RTC memory across deep sleep
+typedef struct TextWidthCache {
+  struct {
+    uint32_t key;       // hash of font, text size and string, 0 = unused
+    uint16_t w;         // width of the string in pixels
+    uint16_t h;         // height of the string in pixels
+    uint16_t len;       // length of the string and...
+    char prefix[2];     // ...its first characters, a hit has to match them as well as the hash
+  } entries[TEXT_CACHE_ENTRIES];
+  uint16_t hits;        // measurements answered from the cache
+  uint16_t misses;      // measurements that walked the glyphs
+} TextWidthCache;
+
+class TextCanvas : public GFXcanvas1 {
+public:
+    // see textCanvas.cpp for documentation of the following class methods
+  TextCanvas(uint16_t w, uint16_t h);
+  void setWidthCache(TextWidthCache *cache);
+  void measureText(const char *text, uint16_t *w, uint16_t *h);
+  void drawText(int16_t x, int16_t y, const char *text, TextAlign align);
+
+protected:
+  virtual void drawGlyph(int16_t x, int16_t y, uint8_t c);
+
+private:
+  TextWidthCache *cache;      // where string sizes are remembered, NULL = measure every time
+
+  bool cachedSize(const char *text, size_t len, uint32_t *key, uint16_t *w, uint16_t *h);
+  void cacheSize(const char *text, size_t len, uint32_t key, uint16_t w, uint16_t h);
+  uint32_t textKey(const char *text, size_t len);
+  bool glyphAt(uint8_t c, int16_t *advance);
+  void glyphBounds(const char *text, uint16_t *w, uint16_t *h, int16_t *pen = NULL);
+};
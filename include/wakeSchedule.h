@@ -0,0 +1,42 @@
+/* The WakeSchedule library (consisting of wakeSchedule.h and wakeSchedule.cpp) works out when the monitor should wake
+    next: just after the next publication of a data source whose cache will have run out, but not before the interval
+    of the SleepPolicy for the time of day has passed. It also corrects the clock for the learned drift of the RTC.
+    Everything it needs is passed in, it reads no globals, so the schedule can be unit tested on the host
+    ([env:native], test/test_wake_schedule).
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+#include "httpsSession.h"
+
+  // Wake policy of a part of the day, a table of them is sorted by start hour. Each runs until the next one starts,
+  // the last one wraps past midnight into the first.
+typedef struct SleepPolicy {
+  uint8_t from_hour;  // local hour the policy starts at
+  uint16_t interval;  // minutes between wakes, at least
+} SleepPolicy;
+
+  // A cached data source and how often it is published
+typedef struct CacheSource {
+  const char *name;
+  void *data;
+  size_t size;
+  uint32_t ttl;       // seconds the data is considered fresh
+  uint32_t period;    // seconds between publications, aligned to unix time
+  uint32_t delay;     // seconds after a period boundary until the new data is available
+} CacheSource;
+
+  // What is known about the cached copy of a source, plain data so it can be kept in RTC memory across deep sleep
+typedef struct CacheStruct {
+  uint32_t fetched;   // unix time of the last successful fetch, 0 = never
+  uint32_t crc;       // crc32 over the cached data
+  HttpValidator validator; // ETag/Last-Modified and body crc of the response the data came from
+} CacheStruct;
+
+  // see wakeSchedule.cpp for documentation of the following functions
+time_t nextWakeTime(time_t now, const struct tm &local, const SleepPolicy policies[], int policy_count,
+                    const CacheStruct cache[], const CacheSource sources[], int source_count);
+double correctedTime(double clock, time_t clock_ref, float drift_ppm);
@@ -0,0 +1,35 @@
+/* pegelonline payloads of the KONSTANZ station (config_example.h) for the water tests of [env:native]:
+    WATER_FIXTURE: the station as the stations endpoint sends it with includeTimeseries and
+      includeCurrentMeasurement, its series in a different order than the live station (WT, LT, W, VA, Q, WG)
+    WATER_MEASUREMENT_FIXTURES: the currentmeasurement bodies of its W, WT and Q series, in the order of
+      water_series[] in main.cpp
+*/
+
+#pragma once
+
+#define WATER_FIXTURE_STATION "66ff3eb4-513b-478b-abd2-2f5126ea66fd"   // uuid of the station
+
+const char WATER_FIXTURE[] = R"({"uuid":"66ff3eb4-513b-478b-abd2-2f5126ea66fd","number":"0906","shortname":"KONSTANZ",)"
+  R"("longname":"KONSTANZ","km":0.0,"agency":"STANDORT KONSTANZ","longitude":9.174,"latitude":47.667,)"
+  R"("water":{"shortname":"BODENSEE","longname":"BODENSEE"},"timeseries":[)"
+  R"({"shortname":"WT","longname":"WASSERTEMPERATUR","unit":"°C","equidistance":15,)"
+  R"("currentMeasurement":{"timestamp":"2024-09-10T22:15:00+02:00","value":19.4}},)"
+  R"({"shortname":"LT","longname":"LUFTTEMPERATUR","unit":"°C","equidistance":15,)"
+  R"("currentMeasurement":{"timestamp":"2024-09-10T22:15:00+02:00","value":14.1}},)"
+  R"({"shortname":"W","longname":"WASSERSTAND ROHDATEN","unit":"cm","equidistance":15,)"
+  R"("currentMeasurement":{"timestamp":"2024-09-10T22:15:00+02:00","value":341.0,"stateMnwMhw":"normal","stateNswHsw":"normal"},)"
+  R"("gaugeZero":{"unit":"m. ü. NN","value":391.89,"validFrom":"1950-01-01"},"characteristicValues":[)"
+  R"({"shortname":"MNW","longname":"Mittleres Niedrigwasser","unit":"cm","value":268,"timespanStart":"2011-11-01","timespanEnd":"2021-10-31"},)"
+  R"({"shortname":"MHW","longname":"Mittleres Hochwasser","unit":"cm","value":466,"timespanStart":"2011-11-01","timespanEnd":"2021-10-31"}]},)"
+  R"({"shortname":"VA","longname":"FLIESSGESCHWINDIGKEIT","unit":"m/s","equidistance":15,)"
+  R"("currentMeasurement":{"timestamp":"2024-09-10T22:15:00+02:00","value":0.42}},)"
+  R"({"shortname":"Q","longname":"ABFLUSS","unit":"m³/s","equidistance":15,)"
+  R"("currentMeasurement":{"timestamp":"2024-09-10T22:15:00+02:00","value":312.0}},)"
+  R"({"shortname":"WG","longname":"WINDGESCHWINDIGKEIT","unit":"m/s","equidistance":10,)"
+  R"("comment":{"shortDescription":"Messung \"vorläufig\"","longDescription":"Rohdaten [ungeprüft]"}}]})";
+
+const char *const WATER_MEASUREMENT_FIXTURES[] = {
+  R"({"timestamp":"2024-09-10T22:15:00+02:00","value":341.0,"stateMnwMhw":"normal","stateNswHsw":"normal"})",
+  R"({"timestamp":"2024-09-10T22:15:00+02:00","value":19.4,"stateMnwMhw":"unknown","stateNswHsw":"unknown"})",
+  R"({"timestamp":"2024-09-10T22:15:00+02:00","value":312.0,"stateMnwMhw":"unknown","stateNswHsw":"unknown"})"
+};
@@ -0,0 +1,111 @@
+/* Data fetched from OpenWeatherMap and pegelonline, as it is kept in RTC memory across deep sleep (main.cpp) and
+    read by the host checks in test/. Plain data, so it can be copied byte for byte.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+const int forecast_counter = 16;    // Number of forecasts to get/show.
+
+  // OpenWeatherMap icon codes, day and night share a condition, night is the odd value
+enum weather_icon : uint8_t {
+  ICON_NONE = 0,
+  ICON_CLEAR_DAY = 2,       // 01d
+  ICON_CLEAR_NIGHT,         // 01n
+  ICON_FEW_CLOUDS_DAY,      // 02d
+  ICON_FEW_CLOUDS_NIGHT,    // 02n
+  ICON_SCATTERED_DAY,       // 03d
+  ICON_SCATTERED_NIGHT,     // 03n
+  ICON_BROKEN_DAY,          // 04d
+  ICON_BROKEN_NIGHT,        // 04n
+  ICON_SHOWER_RAIN_DAY,     // 09d
+  ICON_SHOWER_RAIN_NIGHT,   // 09n
+  ICON_RAIN_DAY,            // 10d
+  ICON_RAIN_NIGHT,          // 10n
+  ICON_THUNDERSTORM_DAY,    // 11d
+  ICON_THUNDERSTORM_NIGHT,  // 11n
+  ICON_SNOW_DAY,            // 13d
+  ICON_SNOW_NIGHT,          // 13n
+  ICON_MIST_DAY,            // 50d
+  ICON_MIST_NIGHT,          // 50n
+  ICON_COUNT
+};
+
+  // pegelonline stateMnwMhw/stateNswHsw values
+enum water_state : uint8_t {
+  WATER_STATE_UNKNOWN,      // "unknown" or anything we don't recognise
+  WATER_STATE_LOW,          // "low"
+  WATER_STATE_NORMAL,       // "normal"
+  WATER_STATE_HIGH,         // "high"
+  WATER_STATE_COMMENTED,    // "commented"
+  WATER_STATE_OUTDATED      // "out-dated"
+};
+
+  // current weather
+typedef struct WeatherStruct {
+  // pressure_trend   trend = LEVEL;
+  uint8_t humidity = 0;
+  uint8_t clouds = 0;
+  uint16_t wind_deg = 0;
+  uint32_t dt = 0;
+  uint32_t sunrise = 0;
+  uint32_t sunset = 0;
+  uint32_t visibility = 0;
+  float temperature = 0;
+  float high = 0;
+  float low = 0;
+  float feels_like = 0;
+  float pressure = 0;
+  float dew_point = 0;
+  float uvi = 0;
+  float wind_speed = 0;
+  float wind_gust = 0;
+  float rain = 0;
+  float snow = 0;
+  char main[16] = "";         // "Clouds"
+  char description[32] = "";  // "overcast clouds"
+  char period[20] = "";       // "2024-09-10 12:00:00"
+  weather_icon icon = ICON_NONE;
+} WeatherStruct;
+
+  // 3 hourly forecasts, one column per field so graphs and statistics read the values they need
+  // as plain contiguous arrays. Entry i of every column belongs to the same forecast.
+typedef struct ForecastStore {
+  uint32_t dt[forecast_counter];          // unix time of the forecast (UTC)
+  float temperature[forecast_counter];
+  float feels_like[forecast_counter];
+  float high[forecast_counter];
+  float low[forecast_counter];
+  float pressure[forecast_counter];
+  float humidity[forecast_counter];
+  float wind_speed[forecast_counter];     // km/h
+  float rain[forecast_counter];           // mm in 3 hours
+  float snow[forecast_counter];           // mm in 3 hours
+  uint16_t wind_deg[forecast_counter];
+  uint8_t clouds[forecast_counter];
+  weather_icon icon[forecast_counter];
+} ForecastStore;
+
+  // water data of a station
+typedef struct WaterStruct {
+  char station[32] = ""; //station name
+  char height_longname[32] = ""; // WASSERSTAND_ROHDATEN
+  char height_unit[8] = ""; // cm
+  float height = 0;
+  char height_timestamp[26] = ""; // timestamp "2024-09-10T08:30:00+02:00"
+  water_state height_stateMnwMhw = WATER_STATE_UNKNOWN; // "normal"
+  water_state height_stateNswHsw = WATER_STATE_UNKNOWN; // "normal"
+
+  char temp_longname[32] = ""; // "WASSERTEMPERATUR"
+  char temp_unit[8] = ""; // "°C"
+  float temp = 0; //22.6
+  char temp_timestamp[26] = ""; // "2024-09-10T08:30:00+02:00"
+
+  char speed_longname[32] = ""; // "ABFLUSS"
+  char speed_unit[8] = ""; // "m³/s"
+  float speed = 0; //92.0
+  char speed_timestamp[26] = ""; // "2024-09-10T08:30:00+02:00"
+
+  uint32_t series_crc[3] = {}; // crc32 of the last currentmeasurement body of each water_series[], 0 = none
+} WaterStruct;
@@ -0,0 +1,30 @@
+# Build step of [env:icon-atlas]: runs the host program it built, which rasterizes every weather icon
+# procedure (printIconAtlas() in src/main.cpp), and writes the header it prints between the marker lines to
+# include/iconAtlas.h. Commit the result, the firmware blits the icons from it.
+#
+#   pio run -e icon-atlas
+
+import subprocess
+
+Import("env")
+
+BEGIN = "-----BEGIN ICON ATLAS-----"
+END = "-----END ICON ATLAS-----"
+
+
+def generate_icon_atlas(source, target, env):
+    program = target[0].get_abspath()
+    output = subprocess.run([program], check=True, capture_output=True, text=True).stdout
+    lines = output.splitlines()
+    if BEGIN not in lines or END not in lines:
+        print(output)
+        env.Exit("iconAtlas.py: %s printed no icon atlas" % program)
+
+    header = lines[lines.index(BEGIN) + 1:lines.index(END)]
+    path = env.subst("$PROJECT_INCLUDE_DIR/iconAtlas.h")
+    with open(path, "w", newline="\n") as f:
+        f.write("\n".join(header) + "\n")
+    print("Icon atlas written to %s" % path)
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}${PROGSUFFIX}", generate_icon_atlas)
@@ -0,0 +1,238 @@
+/* Host stand-in for the parts of the ESP32 Arduino core the firmware uses, so src/ builds and runs on a PC in
+    [env:native]. Serial goes to stdout, millis()/micros() follow the host clock, delay() doesn't wait, the heap
+    reported by ESP is the host heap tracked by hostHeap.cpp. Deep sleep ends the program.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <ctype.h>
+#include <sys/time.h>
+#include <algorithm>
+
+  // The firmware is built for an ESP32, GxEPD2_display_selection_new_style.h picks the display by it
+#ifndef ESP32
+#define ESP32 1
+#endif
+
+#define PROGMEM
+#define RTC_DATA_ATTR
+#define IRAM_ATTR
+#define F(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(void *const *)(addr))
+
+#define PI 3.1415926535897932384626433832795
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define SS 5
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef unsigned int uint;
+
+using std::max;
+using std::min;
+
+  // newer C libraries have these (glibc from 2.38)
+#if !defined(__GLIBC__) || !__GLIBC_PREREQ(2, 38)
+#define HOST_STRLCPY
+size_t strlcpy(char *dst, const char *src, size_t size);
+size_t strlcat(char *dst, const char *src, size_t size);
+#endif
+
+  // Arduino String, strings of up to SSO_SIZE - 1 characters are kept inline like the ESP32 core does, longer
+  // ones on the heap
+class String {
+public:
+  String(const char *cstr = "");
+  String(const String &str);
+  String(String &&str);
+  explicit String(char c);
+  explicit String(unsigned char value, unsigned char base = 10);
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(float value, unsigned int decimals = 2);
+  explicit String(double value, unsigned int decimals = 2);
+  ~String();
+
+  String &operator=(const String &rhs);
+  String &operator=(String &&rhs);
+  String &operator=(const char *cstr);
+
+  bool reserve(unsigned int size);
+  unsigned int length() const { return len; }
+  const char *c_str() const { return buffer(); }
+
+  bool concat(const char *cstr, unsigned int length);
+  bool concat(const char *cstr) { return concat(cstr, cstr ? strlen(cstr) : 0); }
+  bool concat(const String &str) { return concat(str.c_str(), str.len); }
+  bool concat(char c) { return concat(&c, 1); }
+  String &operator+=(const String &rhs) { concat(rhs); return *this; }
+  String &operator+=(const char *cstr) { concat(cstr); return *this; }
+  String &operator+=(char c) { concat(c); return *this; }
+
+  bool equals(const char *cstr) const;
+  bool equals(const String &str) const { return equals(str.c_str()); }
+  bool equalsIgnoreCase(const String &str) const;
+  bool operator==(const String &rhs) const { return equals(rhs); }
+  bool operator==(const char *cstr) const { return equals(cstr); }
+  bool operator!=(const String &rhs) const { return !equals(rhs); }
+  bool operator!=(const char *cstr) const { return !equals(cstr); }
+  bool startsWith(const String &prefix) const;
+  bool endsWith(const String &suffix) const;
+
+  char charAt(unsigned int index) const { return index < len ? buffer()[index] : 0; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const char *str, unsigned int from = 0) const;
+  int indexOf(const String &str, unsigned int from = 0) const { return indexOf(str.c_str(), from); }
+  String substring(unsigned int from) const { return substring(from, len); }
+  String substring(unsigned int from, unsigned int to) const;
+
+  void toUpperCase();
+  void toLowerCase();
+  void trim();
+  long toInt() const { return atol(buffer()); }
+  float toFloat() const { return atof(buffer()); }
+
+private:
+  static const unsigned int SSO_SIZE = 12;  // as on the ESP32, 11 characters and the terminator
+
+  char *heap;           // NULL while the string fits in sso
+  char sso[SSO_SIZE];
+  unsigned int capacity;
+  unsigned int len;
+
+  char *buffer() { return heap != NULL ? heap : sso; }
+  const char *buffer() const { return heap != NULL ? heap : sso; }
+  void assign(const char *cstr, unsigned int length);
+};
+
+String operator+(const String &lhs, const String &rhs);
+String operator+(const String &lhs, const char *rhs);
+String operator+(const char *lhs, const String &rhs);
+String operator+(const String &lhs, char rhs);
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+  size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  size_t print(const char *str) { return write(str); }
+  size_t print(const String &str) { return write(str.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int value, int base = 10) { return print((long)value, base); }
+  size_t print(unsigned int value, int base = 10) { return print((unsigned long)value, base); }
+  size_t print(long value, int base = 10);
+  size_t print(unsigned long value, int base = 10);
+  size_t print(double value, int digits = 2);
+  size_t println(void) { return write("\r\n"); }
+  template <typename T> size_t println(const T &value) { return print(value) + println(); }
+  template <typename T> size_t println(const T &value, int format) { return print(value, format) + println(); }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  void setTimeout(unsigned long timeout) { this->timeout = timeout; }
+  unsigned long getTimeout() const { return timeout; }
+    // Nothing on the host arrives later, so these return what is there instead of waiting for the timeout
+  virtual size_t readBytes(char *buffer, size_t length);
+  size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+  size_t readBytesUntil(char terminator, char *buffer, size_t length);
+  String readStringUntil(char terminator);
+
+protected:
+  unsigned long timeout = 1000;
+};
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long baud) {}
+  void end() {}
+  void flush();
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  operator bool() const { return true; }
+};
+extern HardwareSerial Serial;
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield(void);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+long random(long max);
+long random(long min, long max);
+
+class EspClass {
+public:
+  uint32_t getHeapSize(void);
+  uint32_t getFreeHeap(void);
+  uint32_t getMinFreeHeap(void);
+  uint32_t getMaxAllocHeap(void);
+  void restart(void);
+};
+extern EspClass ESP;
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef enum {
+  ESP_SLEEP_WAKEUP_UNDEFINED,
+  ESP_SLEEP_WAKEUP_ALL,
+  ESP_SLEEP_WAKEUP_EXT0,
+  ESP_SLEEP_WAKEUP_EXT1,
+  ESP_SLEEP_WAKEUP_TIMER,
+  ESP_SLEEP_WAKEUP_TOUCHPAD,
+  ESP_SLEEP_WAKEUP_ULP
+} esp_sleep_wakeup_cause_t;
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause(void);
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us);
+void esp_deep_sleep_start(void) __attribute__((noreturn));
+int64_t esp_timer_get_time(void);
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char *server1, const char *server2 = nullptr,
+                const char *server3 = nullptr);
+bool getLocalTime(struct tm *info, uint32_t ms = 5000);
+
+  // Test hooks: how the next esp_sleep_get_wakeup_cause() answers and what the last sleep asked for
+void hostSetWakeupCause(esp_sleep_wakeup_cause_t cause);
+uint64_t hostSleepTimer(void);
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
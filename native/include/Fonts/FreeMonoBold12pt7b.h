@@ -0,0 +1,9 @@
+/* Host stand-in ([env:native]): the FreeMono fonts come with the Adafruit GFX library, which isn't built on the
+    host. DejaVu_Sans_Bold_11 is drawn in their place, see hostFonts.cpp.
+*/
+
+#pragma once
+
+#include <Adafruit_GFX.h>
+
+extern const GFXfont FreeMonoBold12pt7b;
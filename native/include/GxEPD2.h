@@ -0,0 +1,64 @@
+/* Host stand-in for the GxEPD2 panel driver ([env:native]). Instead of talking SPI to the controller the panel
+    keeps its controller RAM and the image shown in memory: writeImage...() fills the RAM like the controller
+    does (byte aligned, 1 = white), refresh() copies the RAM, or the refreshed window of it, to the image shown.
+    The host program writes that image as a PNG, it is what the real panel would show.
+*/
+
+#pragma once
+
+#include <Adafruit_GFX.h>
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+#define GxEPD_DARKGREY 0x7BEF
+#define GxEPD_LIGHTGREY 0xC618
+
+class GxEPD2_EPD {
+public:
+  const uint16_t WIDTH;
+  const uint16_t HEIGHT;
+  const bool hasPartialUpdate = true;
+  const bool hasFastPartialUpdate = true;
+  uint32_t full_refreshes = 0;    // refreshes of the whole panel
+  uint32_t partial_refreshes = 0; // refreshes of a window
+  uint32_t bytes_written = 0;     // image bytes sent to the controller, "Again" writes included
+  static const GxEPD2_EPD *refreshed;   // panel refreshed last, NULL = none yet
+
+    // see GxEPD2.cpp for documentation of the following class methods
+  GxEPD2_EPD(uint16_t w, uint16_t h);
+  void init(uint32_t serial_diag_bitrate = 0) {}
+  void writeScreenBuffer(uint8_t value = 0xFF);
+  void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false,
+                  bool mirror_y = false, bool pgm = false);
+  void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                      int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false,
+                      bool pgm = false);
+  void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false,
+                       bool mirror_y = false, bool pgm = false);
+  void writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap,
+                           int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false,
+                           bool mirror_y = false, bool pgm = false);
+  void refresh(bool partial_update_mode = false);
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h);
+  void powerOff() {}
+  void hibernate() {}
+  const uint8_t *shown() const { return screen; }
+
+private:
+  static const size_t MAX_BYTES = 400 / 8 * 300;   // the 4.2" panel is the largest one the stand-in holds
+
+  uint8_t ram[MAX_BYTES];       // controller RAM, 1 bit per pixel, 1 = white
+  uint8_t screen[MAX_BYTES];    // what the panel shows, same layout
+
+  void writeWindow(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                   int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y);
+};
+
+  // GDEY042T81 400x300, SSD1683
+class GxEPD2_420_GDEY042T81 : public GxEPD2_EPD {
+public:
+  static const uint16_t WIDTH = 400;
+  static const uint16_t WIDTH_VISIBLE = WIDTH;
+  static const uint16_t HEIGHT = 300;
+  GxEPD2_420_GDEY042T81(int16_t cs, int16_t dc, int16_t rst, int16_t busy) : GxEPD2_EPD(WIDTH, HEIGHT) {}
+};
@@ -0,0 +1,28 @@
+/* Host stand-in for the GxEPD2_BW display class ([env:native]), see GxEPD2.h. The firmware renders into its own
+    canvas and sends that with epd2.writeImage...(), so the paged drawing of the library isn't needed: drawPixel()
+    draws into nothing and firstPage()/nextPage() run a single page.
+*/
+
+#pragma once
+
+#define _GxEPD2_BW_H_
+
+#include "GxEPD2.h"
+
+template <typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_BW : public Adafruit_GFX {
+public:
+  GxEPD2_Type epd2;
+
+  GxEPD2_BW(GxEPD2_Type epd2_instance) : Adafruit_GFX(GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT), epd2(epd2_instance) {}
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {}
+  void init(uint32_t serial_diag_bitrate = 0) {}
+  void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration = 10, bool pulldown_rst_mode = false) {}
+  void setFullWindow() {}
+  void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {}
+  void firstPage() {}
+  bool nextPage() { return false; }
+  void hibernate() { epd2.hibernate(); }
+  void powerOff() { epd2.powerOff(); }
+};
@@ -0,0 +1,6 @@
+/* Host stand-in for GxEPD2_GFX.h ([env:native]), the GxEPD2_GFX base class is not used by the firmware
+*/
+
+#pragma once
+
+#include "GxEPD2.h"
@@ -0,0 +1,9 @@
+/* Host stand-in for the HTTPClient library of the ESP32 Arduino core ([env:native]), which includes the wifi
+    clients like the original does
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
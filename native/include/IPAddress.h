@@ -0,0 +1,19 @@
+/* Host stand-in for the IPAddress class of the ESP32 Arduino core ([env:native])
+*/
+
+#pragma once
+
+#include <Arduino.h>
+
+class IPAddress {
+public:
+  IPAddress() : address(0) {}
+  IPAddress(uint32_t address) : address(address) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : address(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+  operator uint32_t() const { return address; }
+  uint8_t operator[](int index) const { return address >> (8 * index); }
+  String toString() const;
+
+private:
+  uint32_t address;   // network byte order, as on the ESP32
+};
@@ -0,0 +1,6 @@
+/* ArduinoJson reads from a Stream through this header of the Arduino core
+*/
+
+#pragma once
+
+#include <Arduino.h>
@@ -0,0 +1,82 @@
+/* Host stand-in for the WiFi library of the ESP32 Arduino core ([env:native]). There is no radio: begin() joins the
+    network at once and reports ARDUINO_EVENT_WIFI_STA_GOT_IP to the registered handlers before it returns.
+*/
+
+#pragma once
+
+#include <functional>
+#include <Arduino.h>
+#include "IPAddress.h"
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA,
+  WIFI_AP,
+  WIFI_AP_STA
+} wifi_mode_t;
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL,
+  WL_SCAN_COMPLETED,
+  WL_CONNECTED,
+  WL_CONNECT_FAILED,
+  WL_CONNECTION_LOST,
+  WL_DISCONNECTED
+} wl_status_t;
+
+typedef enum {
+  ARDUINO_EVENT_WIFI_READY = 0,
+  ARDUINO_EVENT_WIFI_STA_START,
+  ARDUINO_EVENT_WIFI_STA_STOP,
+  ARDUINO_EVENT_WIFI_STA_CONNECTED,
+  ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+  ARDUINO_EVENT_WIFI_STA_GOT_IP,
+  ARDUINO_EVENT_WIFI_STA_LOST_IP
+} arduino_event_id_t;
+
+typedef arduino_event_id_t WiFiEvent_t;
+typedef struct WiFiEventInfo_t {
+  uint32_t reserved;
+} WiFiEventInfo_t;
+typedef void (*WiFiEventCb)(WiFiEvent_t event);
+typedef std::function<void(WiFiEvent_t event, WiFiEventInfo_t info)> WiFiEventFuncCb;
+typedef size_t wifi_event_id_t;
+
+class WiFiClass {
+public:
+  wl_status_t begin(const char *ssid, const char *passphrase = NULL, int32_t channel = 0, const uint8_t *bssid = NULL,
+                    bool connect = true);
+  bool config(IPAddress local_ip, IPAddress gateway, IPAddress subnet, IPAddress dns1 = (uint32_t)0,
+              IPAddress dns2 = (uint32_t)0);
+  bool disconnect(bool wifioff = false, bool eraseap = false);
+  bool mode(wifi_mode_t mode);
+  void persistent(bool persistent) {}
+  bool setAutoReconnect(bool autoReconnect) { return true; }
+  wl_status_t status() { return state; }
+  bool isConnected() { return state == WL_CONNECTED; }
+
+  IPAddress localIP() { return ip; }
+  IPAddress gatewayIP() { return gateway; }
+  IPAddress subnetMask() { return subnet; }
+  IPAddress dnsIP(uint8_t dns_no = 0) { return dns; }
+  int8_t RSSI() { return state == WL_CONNECTED ? -67 : 0; }
+  uint8_t *BSSID() { return bssid; }
+  int32_t channel() { return state == WL_CONNECTED ? channel_ : 0; }
+
+  wifi_event_id_t onEvent(WiFiEventFuncCb cb, arduino_event_id_t event);
+
+private:
+  static const int MAX_HANDLERS = 8;
+
+  wl_status_t state = WL_IDLE_STATUS;
+  IPAddress ip, gateway, subnet, dns;
+  uint8_t bssid[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+  int32_t channel_ = 6;
+  WiFiEventFuncCb handlers[MAX_HANDLERS];
+  arduino_event_id_t handler_events[MAX_HANDLERS];
+  int handler_count = 0;
+
+  void raise(arduino_event_id_t event);
+};
+extern WiFiClass WiFi;
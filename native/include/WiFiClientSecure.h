@@ -0,0 +1,15 @@
+/* Host stand-in for WiFiClientSecure ([env:native]). The firmware talks TLS through HttpsSession (mbedTLS, see
+    native/include/mbedtls/), the client only has to exist.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+
+class WiFiClientSecure {
+public:
+  WiFiClientSecure() {}
+  void setInsecure() {}
+  void stop() {}
+  bool connected() { return false; }
+};
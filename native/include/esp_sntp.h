@@ -0,0 +1,11 @@
+/* Host stand-in for the SNTP notification of the ESP-IDF ([env:native]). The host clock is taken as synced:
+    configTime() calls the notification right away.
+*/
+
+#pragma once
+
+#include <sys/time.h>
+
+typedef void (*sntp_sync_time_cb_t)(struct timeval *tv);
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback);
@@ -0,0 +1,23 @@
+/* Host stand-in for the FreeRTOS types and macros the firmware uses ([env:native]). There is a single thread on
+    the host: a created task runs to completion inside xTaskCreate...(), see freertos.cpp.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define portMAX_DELAY 0xffffffffUL
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portNUM_PROCESSORS 2
+#define tskNO_AFFINITY 0x7fffffff
@@ -0,0 +1,18 @@
+/* Host stand-in for FreeRTOS event groups ([env:native]). Tasks have finished by the time anyone waits, so
+    xEventGroupWaitBits() returns the bits that are set instead of blocking.
+*/
+
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef void *EventGroupHandle_t;
+typedef uint32_t EventBits_t;
+
+EventGroupHandle_t xEventGroupCreate(void);
+void vEventGroupDelete(EventGroupHandle_t group);
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group);
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+                                BaseType_t wait_for_all, TickType_t ticks);
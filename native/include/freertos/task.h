@@ -0,0 +1,13 @@
+/* Host stand-in for the FreeRTOS task API ([env:native]), see FreeRTOS.h
+*/
+
+#pragma once
+
+#include "FreeRTOS.h"
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char *name, uint32_t stack_depth, void *param,
+                                   UBaseType_t priority, TaskHandle_t *created, BaseType_t core);
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stack_depth, void *param,
+                       UBaseType_t priority, TaskHandle_t *created);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
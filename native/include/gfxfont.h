@@ -0,0 +1,23 @@
+/* Font structures of Adafruit_GFX, as the fonts in include/ (made with fontconvert) expect them ([env:native])
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+  uint16_t bitmapOffset;  // offset of the glyph in the font's bitmap
+  uint8_t width;          // bitmap size in pixels
+  uint8_t height;
+  uint8_t xAdvance;       // distance to advance the cursor along x
+  int8_t xOffset;         // from the cursor to the upper left corner of the bitmap
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t *bitmap;        // glyph bitmaps, concatenated
+  GFXglyph *glyph;        // glyph array
+  uint16_t first;         // first and last character in the font
+  uint16_t last;
+  uint8_t yAdvance;       // newline distance along y
+} GFXfont;
@@ -0,0 +1,21 @@
+/* Heap tracking for [env:native]: malloc() and friends are wrapped (glibc only, elsewhere the figures stay 0) so
+    benchmarks and tests can report the peak heap and the number of allocations of a piece of code, as
+    ESP.getFreeHeap() does on the device.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct HostHeapStats {
+  size_t in_use;          // bytes allocated and not yet freed
+  size_t peak;            // most bytes in use since the last hostHeapReset()
+  uint32_t allocations;   // malloc(), calloc() and growing realloc() calls since the last hostHeapReset()
+} HostHeapStats;
+
+  // see hostHeap.cpp for documentation of the following functions
+void hostHeapReset(void);
+HostHeapStats hostHeapStats(void);
+void *hostUntrackedAlloc(size_t size);
+void hostUntrackedFree(void *ptr);
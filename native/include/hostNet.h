@@ -0,0 +1,15 @@
+/* Scripted network for [env:native]: the mbedTLS stand-in answers each request sent to a host with the next raw
+    HTTP response (status line, headers and body) queued for that host here. A request nothing is queued for gets
+    no answer, the connection reads as closed.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+  // see native/src/mbedtls.cpp for documentation of the following functions
+bool hostNetReply(const char *host, const void *response, size_t len);
+void hostNetReset(void);
+uint32_t hostNetRequests(void);
+uint32_t hostNetConnects(void);
@@ -0,0 +1,10 @@
+/* PNG files of [env:native]: render output to look at, and the reference images of the render checks
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+  // see hostPng.cpp for documentation of the following functions
+bool hostWritePng(const char *path, const uint8_t *bitmap, uint16_t width, uint16_t height);
+bool hostReadPng(const char *path, uint8_t *bitmap, uint16_t width, uint16_t height);
@@ -0,0 +1,14 @@
+/* Host stand-in for the mbedTLS entropy source ([env:native])
+*/
+
+#pragma once
+
+#include <stddef.h>
+
+typedef struct mbedtls_entropy_context {
+  int initialised;
+} mbedtls_entropy_context;
+
+void mbedtls_entropy_init(mbedtls_entropy_context *ctx);
+void mbedtls_entropy_free(mbedtls_entropy_context *ctx);
+int mbedtls_entropy_func(void *data, unsigned char *output, size_t len);
@@ -0,0 +1,26 @@
+/* Host stand-in for the mbedTLS network layer ([env:native]), a connection is a slot of the loopback in
+    native/src/mbedtls.cpp
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MBEDTLS_NET_PROTO_TCP 0
+#define MBEDTLS_NET_PROTO_UDP 1
+
+#define MBEDTLS_ERR_NET_UNKNOWN_HOST -0x0052
+#define MBEDTLS_ERR_NET_CONNECT_FAILED -0x0044
+#define MBEDTLS_ERR_NET_CONN_RESET -0x0050
+
+typedef struct mbedtls_net_context {
+  int fd;           // loopback slot, -1 = not connected
+} mbedtls_net_context;
+
+void mbedtls_net_init(mbedtls_net_context *ctx);
+int mbedtls_net_connect(mbedtls_net_context *ctx, const char *host, const char *port, int proto);
+int mbedtls_net_send(void *ctx, const unsigned char *buf, size_t len);
+int mbedtls_net_recv(void *ctx, unsigned char *buf, size_t len);
+int mbedtls_net_recv_timeout(void *ctx, unsigned char *buf, size_t len, uint32_t timeout);
+void mbedtls_net_free(mbedtls_net_context *ctx);
@@ -0,0 +1,95 @@
+/* Host stand-in for the mbedTLS SSL API HttpsSession uses ([env:native]). There is no TLS on the host: the
+    "connection" is a loopback that answers each request with the next response queued for the host by
+    hostNetReply() (see hostNet.h). The handshake goes through the same states as a real one, resumed when the
+    session offered was saved from a connection to the same host.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MBEDTLS_SSL_IS_CLIENT 0
+#define MBEDTLS_SSL_TRANSPORT_STREAM 0
+#define MBEDTLS_SSL_PRESET_DEFAULT 0
+#define MBEDTLS_SSL_VERIFY_NONE 0
+#define MBEDTLS_SSL_VERIFY_OPTIONAL 1
+#define MBEDTLS_SSL_VERIFY_REQUIRED 2
+
+#define MBEDTLS_ERR_SSL_BAD_INPUT_DATA -0x7100
+#define MBEDTLS_ERR_SSL_ALLOC_FAILED -0x7F00
+#define MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL -0x6A00
+#define MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY -0x7880
+#define MBEDTLS_ERR_SSL_WANT_READ -0x6900
+#define MBEDTLS_ERR_SSL_WANT_WRITE -0x6880
+#define MBEDTLS_ERR_SSL_TIMEOUT -0x6800
+
+typedef enum {
+  MBEDTLS_SSL_HELLO_REQUEST,
+  MBEDTLS_SSL_CLIENT_HELLO,
+  MBEDTLS_SSL_SERVER_HELLO,
+  MBEDTLS_SSL_SERVER_CERTIFICATE,
+  MBEDTLS_SSL_SERVER_KEY_EXCHANGE,
+  MBEDTLS_SSL_CERTIFICATE_REQUEST,
+  MBEDTLS_SSL_SERVER_HELLO_DONE,
+  MBEDTLS_SSL_CLIENT_CERTIFICATE,
+  MBEDTLS_SSL_CLIENT_KEY_EXCHANGE,
+  MBEDTLS_SSL_CERTIFICATE_VERIFY,
+  MBEDTLS_SSL_CLIENT_CHANGE_CIPHER_SPEC,
+  MBEDTLS_SSL_CLIENT_FINISHED,
+  MBEDTLS_SSL_SERVER_CHANGE_CIPHER_SPEC,
+  MBEDTLS_SSL_SERVER_FINISHED,
+  MBEDTLS_SSL_FLUSH_BUFFERS,
+  MBEDTLS_SSL_HANDSHAKE_WRAPUP,
+  MBEDTLS_SSL_HANDSHAKE_OVER
+} mbedtls_ssl_states;
+
+typedef int mbedtls_ssl_send_t(void *ctx, const unsigned char *buf, size_t len);
+typedef int mbedtls_ssl_recv_t(void *ctx, unsigned char *buf, size_t len);
+typedef int mbedtls_ssl_recv_timeout_t(void *ctx, unsigned char *buf, size_t len, uint32_t timeout);
+
+typedef struct mbedtls_ssl_session {
+  char host[64];    // host the session was established with, "" = none
+} mbedtls_ssl_session;
+
+typedef struct mbedtls_ssl_config {
+  int endpoint;
+  int authmode;
+  uint32_t read_timeout;
+  int (*f_rng)(void *, unsigned char *, size_t);
+  void *p_rng;
+} mbedtls_ssl_config;
+
+typedef struct mbedtls_ssl_context {
+  int state;                  // mbedtls_ssl_states
+  const mbedtls_ssl_config *conf;
+  void *p_bio;                // the mbedtls_net_context
+  unsigned char *buffers;     // record buffers, allocated by mbedtls_ssl_setup() like the real ones
+  char hostname[64];
+  mbedtls_ssl_session session;  // offered by mbedtls_ssl_set_session(), then the one negotiated
+  bool resumed;
+} mbedtls_ssl_context;
+
+void mbedtls_ssl_init(mbedtls_ssl_context *ssl);
+void mbedtls_ssl_free(mbedtls_ssl_context *ssl);
+void mbedtls_ssl_config_init(mbedtls_ssl_config *conf);
+void mbedtls_ssl_config_free(mbedtls_ssl_config *conf);
+int mbedtls_ssl_config_defaults(mbedtls_ssl_config *conf, int endpoint, int transport, int preset);
+void mbedtls_ssl_conf_authmode(mbedtls_ssl_config *conf, int authmode);
+void mbedtls_ssl_conf_rng(mbedtls_ssl_config *conf, int (*f_rng)(void *, unsigned char *, size_t), void *p_rng);
+void mbedtls_ssl_conf_read_timeout(mbedtls_ssl_config *conf, uint32_t timeout);
+int mbedtls_ssl_setup(mbedtls_ssl_context *ssl, const mbedtls_ssl_config *conf);
+int mbedtls_ssl_set_hostname(mbedtls_ssl_context *ssl, const char *hostname);
+void mbedtls_ssl_set_bio(mbedtls_ssl_context *ssl, void *p_bio, mbedtls_ssl_send_t *f_send, mbedtls_ssl_recv_t *f_recv,
+                         mbedtls_ssl_recv_timeout_t *f_recv_timeout);
+int mbedtls_ssl_handshake_step(mbedtls_ssl_context *ssl);
+int mbedtls_ssl_read(mbedtls_ssl_context *ssl, unsigned char *buf, size_t len);
+int mbedtls_ssl_write(mbedtls_ssl_context *ssl, const unsigned char *buf, size_t len);
+int mbedtls_ssl_close_notify(mbedtls_ssl_context *ssl);
+
+void mbedtls_ssl_session_init(mbedtls_ssl_session *session);
+void mbedtls_ssl_session_free(mbedtls_ssl_session *session);
+int mbedtls_ssl_set_session(mbedtls_ssl_context *ssl, const mbedtls_ssl_session *session);
+int mbedtls_ssl_get_session(const mbedtls_ssl_context *ssl, mbedtls_ssl_session *session);
+int mbedtls_ssl_session_save(const mbedtls_ssl_session *session, unsigned char *buf, size_t buf_len, size_t *olen);
+int mbedtls_ssl_session_load(mbedtls_ssl_session *session, const unsigned char *buf, size_t len);
@@ -0,0 +1,8 @@
+/* Host stand-in for the ESP32 ROM crc functions ([env:native]), same results as the ROM versions
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+uint32_t crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len);
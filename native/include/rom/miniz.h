@@ -0,0 +1,85 @@
+/* Host stand-in for the tinfl inflater in the ESP32 ROM ([env:native]), on top of zlib's raw inflate (link with
+    -lz). Same buffer contract as the ROM version: the output buffer is a 32 KB ring that back references point
+    into. zlib doesn't read ahead past the end of the deflate data, so m_num_bits stays 0 and the gzip trailer is
+    read from the input as it is. The ROM inflater keeps all of its state in the tinfl_decompressor, so zlib's
+    own state is allocated outside the tracked heap (hostHeap.h) to keep the heap figures those of the device.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <zlib.h>
+#include "hostHeap.h"
+
+#define TINFL_LZ_DICT_SIZE 32768
+
+enum {
+  TINFL_FLAG_PARSE_ZLIB_HEADER = 1,
+  TINFL_FLAG_HAS_MORE_INPUT = 2,
+  TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF = 4,
+  TINFL_FLAG_COMPUTE_ADLER32 = 8
+};
+
+typedef enum {
+  TINFL_STATUS_BAD_PARAM = -3,
+  TINFL_STATUS_ADLER32_MISMATCH = -2,
+  TINFL_STATUS_FAILED = -1,
+  TINFL_STATUS_DONE = 0,
+  TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+  TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+typedef uint32_t mz_uint32;
+typedef uint64_t tinfl_bit_buf_t;
+
+typedef struct tinfl_decompressor {
+  z_stream z;
+  bool started;             // inflateInit2() done and inflateEnd() not yet
+  mz_uint32 m_num_bits;     // bits read ahead, always 0 with zlib
+  tinfl_bit_buf_t m_bit_buf;
+} tinfl_decompressor;
+
+#define tinfl_init(r) memset((r), 0, sizeof(*(r)))
+
+static inline voidpf tinfl_zalloc(voidpf opaque, uInt items, uInt size) {
+  return hostUntrackedAlloc((size_t)items * size);
+}
+
+static inline void tinfl_zfree(voidpf opaque, voidpf address) {
+  hostUntrackedFree(address);
+}
+
+static inline tinfl_status tinfl_decompress(tinfl_decompressor *r, const uint8_t *in, size_t *in_size,
+                                            uint8_t *out_start, uint8_t *out_next, size_t *out_size, uint32_t flags) {
+  if (!r->started) {
+    r->z.zalloc = tinfl_zalloc;
+    r->z.zfree = tinfl_zfree;
+    if (inflateInit2(&r->z, (flags & TINFL_FLAG_PARSE_ZLIB_HEADER) ? 15 : -15) != Z_OK)
+      return TINFL_STATUS_FAILED;
+    r->started = true;
+  }
+  r->z.next_in = (Bytef *)in;
+  r->z.avail_in = *in_size;
+  r->z.next_out = out_next;
+  r->z.avail_out = *out_size;
+
+  int ret = inflate(&r->z, Z_NO_FLUSH);
+  *in_size -= r->z.avail_in;
+  *out_size -= r->z.avail_out;
+
+  if (ret == Z_STREAM_END) {
+    inflateEnd(&r->z);
+    r->started = false;
+    return TINFL_STATUS_DONE;
+  }
+  if (ret != Z_OK && ret != Z_BUF_ERROR) {
+    inflateEnd(&r->z);
+    r->started = false;
+    return TINFL_STATUS_FAILED;
+  }
+  if (r->z.avail_out == 0)
+    return TINFL_STATUS_HAS_MORE_OUTPUT;
+  return (flags & TINFL_FLAG_HAS_MORE_INPUT) ? TINFL_STATUS_NEEDS_MORE_INPUT : TINFL_STATUS_FAILED;
+}
@@ -0,0 +1,828 @@
+/* Host port of the Adafruit_GFX core and GFXcanvas1 for [env:native], see Adafruit_GFX.h. The algorithms follow
+    the Adafruit GFX library line by line, a change here changes pixels, so keep them in step with the library.
+*/
+
+#include "Adafruit_GFX.h"
+
+#define swapInt16(a, b) { int16_t t = a; a = b; b = t; }
+
+  // Classic 5x7 font, 5 columns per character, LSB at the top. Only printable ASCII, the rest draws blank.
+static const uint8_t font_ascii[][5] = {
+  {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, {0x00, 0x07, 0x00, 0x07, 0x00}, // ' ' ! "
+  {0x14, 0x7F, 0x14, 0x7F, 0x14}, {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62}, // # $ %
+  {0x36, 0x49, 0x56, 0x20, 0x50}, {0x00, 0x08, 0x07, 0x03, 0x00}, {0x00, 0x1C, 0x22, 0x41, 0x00}, // & ' (
+  {0x00, 0x41, 0x22, 0x1C, 0x00}, {0x2A, 0x1C, 0x7F, 0x1C, 0x2A}, {0x08, 0x08, 0x3E, 0x08, 0x08}, // ) * +
+  {0x00, 0x80, 0x70, 0x30, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, {0x00, 0x00, 0x60, 0x60, 0x00}, // , - .
+  {0x20, 0x10, 0x08, 0x04, 0x02}, {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00}, // / 0 1
+  {0x72, 0x49, 0x49, 0x49, 0x46}, {0x21, 0x41, 0x49, 0x4D, 0x33}, {0x18, 0x14, 0x12, 0x7F, 0x10}, // 2 3 4
+  {0x27, 0x45, 0x45, 0x45, 0x39}, {0x3C, 0x4A, 0x49, 0x49, 0x31}, {0x41, 0x21, 0x11, 0x09, 0x07}, // 5 6 7
+  {0x36, 0x49, 0x49, 0x49, 0x36}, {0x46, 0x49, 0x49, 0x29, 0x1E}, {0x00, 0x00, 0x14, 0x00, 0x00}, // 8 9 :
+  {0x00, 0x40, 0x34, 0x00, 0x00}, {0x00, 0x08, 0x14, 0x22, 0x41}, {0x14, 0x14, 0x14, 0x14, 0x14}, // ; < =
+  {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x59, 0x09, 0x06}, {0x3E, 0x41, 0x5D, 0x59, 0x4E}, // > ? @
+  {0x7C, 0x12, 0x11, 0x12, 0x7C}, {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22}, // A B C
+  {0x7F, 0x41, 0x41, 0x41, 0x3E}, {0x7F, 0x49, 0x49, 0x49, 0x41}, {0x7F, 0x09, 0x09, 0x09, 0x01}, // D E F
+  {0x3E, 0x41, 0x41, 0x51, 0x73}, {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00}, // G H I
+  {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, {0x7F, 0x40, 0x40, 0x40, 0x40}, // J K L
+  {0x7F, 0x02, 0x1C, 0x02, 0x7F}, {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E}, // M N O
+  {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, {0x7F, 0x09, 0x19, 0x29, 0x46}, // P Q R
+  {0x26, 0x49, 0x49, 0x49, 0x32}, {0x03, 0x01, 0x7F, 0x01, 0x03}, {0x3F, 0x40, 0x40, 0x40, 0x3F}, // S T U
+  {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F}, {0x63, 0x14, 0x08, 0x14, 0x63}, // V W X
+  {0x03, 0x04, 0x78, 0x04, 0x03}, {0x61, 0x59, 0x49, 0x4D, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x41}, // Y Z [
+  {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x41, 0x7F}, {0x04, 0x02, 0x01, 0x02, 0x04}, // \ ] ^
+  {0x40, 0x40, 0x40, 0x40, 0x40}, {0x00, 0x03, 0x07, 0x08, 0x00}, {0x20, 0x54, 0x54, 0x78, 0x40}, // _ ` a
+  {0x7F, 0x28, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x28}, {0x38, 0x44, 0x44, 0x28, 0x7F}, // b c d
+  {0x38, 0x54, 0x54, 0x54, 0x18}, {0x00, 0x08, 0x7E, 0x09, 0x02}, {0x18, 0xA4, 0xA4, 0x9C, 0x78}, // e f g
+  {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, {0x20, 0x40, 0x40, 0x3D, 0x00}, // h i j
+  {0x7F, 0x10, 0x28, 0x44, 0x00}, {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x78, 0x04, 0x78}, // k l m
+  {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, {0xFC, 0x18, 0x24, 0x24, 0x18}, // n o p
+  {0x18, 0x24, 0x24, 0x18, 0xFC}, {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x24}, // q r s
+  {0x04, 0x04, 0x3F, 0x44, 0x24}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, {0x1C, 0x20, 0x40, 0x20, 0x1C}, // t u v
+  {0x3C, 0x40, 0x30, 0x40, 0x3C}, {0x44, 0x28, 0x10, 0x28, 0x44}, {0x4C, 0x90, 0x90, 0x90, 0x7C}, // w x y
+  {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, {0x00, 0x00, 0x77, 0x00, 0x00}, // z { |
+  {0x00, 0x41, 0x36, 0x08, 0x00}, {0x02, 0x01, 0x02, 0x04, 0x02}                                  // } ~
+};
+
+/* fontColumn()
+  Parameters:
+    unsigned char c: character, as the classic font indexes it
+    int8_t i: column 0..4
+  Returns:
+    uint8_t: the column of the character, bit 0 at the top
+*/
+static uint8_t fontColumn(unsigned char c, int8_t i) {
+  if (c < ' ' || c > '~')
+    return 0;
+  return font_ascii[c - ' '][i];
+}
+
+/* Adafruit_GFX::Adafruit_GFX()
+    Class object constructor
+  Parameters:
+    int16_t w, h: display size without rotation
+  Returns: None
+*/
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
+  _width = WIDTH;
+  _height = HEIGHT;
+  rotation = 0;
+  cursor_y = cursor_x = 0;
+  textsize_x = textsize_y = 1;
+  textcolor = textbgcolor = 0xFFFF;
+  wrap = true;
+  _cp437 = false;
+  gfxFont = NULL;
+}
+
+/* Adafruit_GFX::writeLine()
+    Bresenham line, pixel by pixel
+*/
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    swapInt16(x0, y0);
+    swapInt16(x1, y1);
+  }
+  if (x0 > x1) {
+    swapInt16(x0, x1);
+    swapInt16(y0, y1);
+  }
+
+  int16_t dx = x1 - x0;
+  int16_t dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t ystep = (y0 < y1) ? 1 : -1;
+
+  for (; x0 <= x1; x0++) {
+    if (steep)
+      writePixel(y0, x0, color);
+    else
+      writePixel(x0, y0, color);
+    err -= dy;
+    if (err < 0) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+void Adafruit_GFX::startWrite(void) {
+}
+
+void Adafruit_GFX::writePixel(int16_t x, int16_t y, uint16_t color) {
+  drawPixel(x, y, color);
+}
+
+void Adafruit_GFX::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  drawFastVLine(x, y, h, color);
+}
+
+void Adafruit_GFX::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  drawFastHLine(x, y, w, color);
+}
+
+void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  fillRect(x, y, w, h, color);
+}
+
+void Adafruit_GFX::endWrite(void) {
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  startWrite();
+  writeLine(x, y, x, y + h - 1, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  startWrite();
+  writeLine(x, y, x + w - 1, y, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  startWrite();
+  for (int16_t i = x; i < x + w; i++)
+    writeFastVLine(i, y, h, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+/* Adafruit_GFX::drawLine()
+    Horizontal and vertical lines become fast lines, the rest is drawn with writeLine()
+*/
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  if (x0 == x1) {
+    if (y0 > y1)
+      swapInt16(y0, y1);
+    drawFastVLine(x0, y0, y1 - y0 + 1, color);
+  } else if (y0 == y1) {
+    if (x0 > x1)
+      swapInt16(x0, x1);
+    drawFastHLine(x0, y0, x1 - x0 + 1, color);
+  } else {
+    startWrite();
+    writeLine(x0, y0, x1, y1, color);
+    endWrite();
+  }
+}
+
+void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  int16_t f = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+
+  startWrite();
+  writePixel(x0, y0 + r, color);
+  writePixel(x0, y0 - r, color);
+  writePixel(x0 + r, y0, color);
+  writePixel(x0 - r, y0, color);
+
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    writePixel(x0 + x, y0 + y, color);
+    writePixel(x0 - x, y0 + y, color);
+    writePixel(x0 + x, y0 - y, color);
+    writePixel(x0 - x, y0 - y, color);
+    writePixel(x0 + y, y0 + x, color);
+    writePixel(x0 - y, y0 + x, color);
+    writePixel(x0 + y, y0 - x, color);
+    writePixel(x0 - y, y0 - x, color);
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  startWrite();
+  writeFastVLine(x0, y0 - r, 2 * r + 1, color);
+  fillCircleHelper(x0, y0, r, 3, 0, color);
+  endWrite();
+}
+
+/* Adafruit_GFX::fillCircleHelper()
+    Fill the left (corners bit 1) and/or right (bit 0) half of a circle with vertical lines
+*/
+void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta,
+                                    uint16_t color) {
+  int16_t f = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t px = x;
+  int16_t py = y;
+
+  delta++;    // avoid some +1's in the loop
+
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    // These checks avoid double drawing certain lines
+    if (x < (y + 1)) {
+      if (corners & 1)
+        writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+      if (corners & 2)
+        writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+    }
+    if (y != py) {
+      if (corners & 1)
+        writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+      if (corners & 2)
+        writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  startWrite();
+  writeFastHLine(x, y, w, color);
+  writeFastHLine(x, y + h - 1, w, color);
+  writeFastVLine(x, y, h, color);
+  writeFastVLine(x + w - 1, y, h, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                uint16_t color) {
+  drawLine(x0, y0, x1, y1, color);
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x0, y0, color);
+}
+
+/* Adafruit_GFX::fillTriangle()
+    Fill a triangle with horizontal spans, the upper part (y0..y1) and the lower part (y1..y2) separately
+*/
+void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                uint16_t color) {
+  int16_t a, b, y, last;
+
+  // Sort coordinates by y (y2 >= y1 >= y0)
+  if (y0 > y1) {
+    swapInt16(y0, y1);
+    swapInt16(x0, x1);
+  }
+  if (y1 > y2) {
+    swapInt16(y2, y1);
+    swapInt16(x2, x1);
+  }
+  if (y0 > y1) {
+    swapInt16(y0, y1);
+    swapInt16(x0, x1);
+  }
+
+  startWrite();
+  if (y0 == y2) {     // all on the same line
+    a = b = x0;
+    if (x1 < a)
+      a = x1;
+    else if (x1 > b)
+      b = x1;
+    if (x2 < a)
+      a = x2;
+    else if (x2 > b)
+      b = x2;
+    writeFastHLine(a, y0, b - a + 1, color);
+    endWrite();
+    return;
+  }
+
+  int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0;
+
+  // Upper part, the line y1 is included here only if y1 == y2 (flat bottom)
+  last = (y1 == y2) ? y1 : y1 - 1;
+  for (y = y0; y <= last; y++) {
+    a = x0 + sa / dy01;
+    b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b)
+      swapInt16(a, b);
+    writeFastHLine(a, y, b - a + 1, color);
+  }
+
+  // Lower part
+  sa = (int32_t)dx12 * (y - y1);
+  sb = (int32_t)dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    a = x1 + sa / dy12;
+    b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b)
+      swapInt16(a, b);
+    writeFastHLine(a, y, b - a + 1, color);
+  }
+  endWrite();
+}
+
+/* Adafruit_GFX::drawBitmap()
+    Draw the set bits of a 1 bit bitmap (rows padded to whole bytes, MSB first) in color, clear bits are left
+*/
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+  int16_t byteWidth = (w + 7) / 8;
+  uint8_t b = 0;
+
+  startWrite();
+  for (int16_t j = 0; j < h; j++, y++) {
+    for (int16_t i = 0; i < w; i++) {
+      if (i & 7)
+        b <<= 1;
+      else
+        b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+      if (b & 0x80)
+        writePixel(x + i, y, color);
+    }
+  }
+  endWrite();
+}
+
+/* Adafruit_GFX::drawBitmap()
+    As above, clear bits are drawn in bg
+*/
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color,
+                              uint16_t bg) {
+  int16_t byteWidth = (w + 7) / 8;
+  uint8_t b = 0;
+
+  startWrite();
+  for (int16_t j = 0; j < h; j++, y++) {
+    for (int16_t i = 0; i < w; i++) {
+      if (i & 7)
+        b <<= 1;
+      else
+        b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+      writePixel(x + i, y, (b & 0x80) ? color : bg);
+    }
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+  drawChar(x, y, c, color, bg, size, size);
+}
+
+/* Adafruit_GFX::drawChar()
+    Draw a character with its upper left corner (classic font) or its baseline (GFXfont) at x, y
+*/
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x,
+                            uint8_t size_y) {
+  if (!gfxFont) {
+    if ((x >= _width) || (y >= _height) || ((x + 6 * size_x - 1) < 0) || ((y + 8 * size_y - 1) < 0))
+      return;
+    if (!_cp437 && (c >= 176))
+      c++;    // the library's table has a character missing at 176, it skips over it
+
+    startWrite();
+    for (int8_t i = 0; i < 5; i++) {
+      uint8_t line = fontColumn(c, i);
+      for (int8_t j = 0; j < 8; j++, line >>= 1) {
+        if (line & 1) {
+          if (size_x == 1 && size_y == 1)
+            writePixel(x + i, y + j, color);
+          else
+            writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, color);
+        } else if (bg != color) {
+          if (size_x == 1 && size_y == 1)
+            writePixel(x + i, y + j, bg);
+          else
+            writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, bg);
+        }
+      }
+    }
+    if (bg != color) {
+      if (size_x == 1 && size_y == 1)
+        writeFastVLine(x + 5, y, 8, bg);
+      else
+        writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
+    }
+    endWrite();
+    return;
+  }
+
+  c -= (uint8_t)gfxFont->first;
+  const GFXglyph *glyph = &gfxFont->glyph[c];
+  const uint8_t *bitmap = gfxFont->bitmap;
+  uint16_t bo = glyph->bitmapOffset;
+  uint8_t w = glyph->width, h = glyph->height;
+  int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+  uint8_t bits = 0, bit = 0;
+  int16_t xo16 = 0, yo16 = 0;
+
+  if (size_x > 1 || size_y > 1) {
+    xo16 = xo;
+    yo16 = yo;
+  }
+
+  startWrite();
+  for (uint8_t yy = 0; yy < h; yy++) {
+    for (uint8_t xx = 0; xx < w; xx++) {
+      if (!(bit++ & 7))
+        bits = bitmap[bo++];
+      if (bits & 0x80) {
+        if (size_x == 1 && size_y == 1)
+          writePixel(x + xo + xx, y + yo + yy, color);
+        else
+          writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y, size_x, size_y, color);
+      }
+      bits <<= 1;
+    }
+  }
+  endWrite();
+}
+
+/* Adafruit_GFX::write()
+    Print interface, draws a character at the cursor and moves the cursor on
+*/
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (!gfxFont) {
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += textsize_y * 8;
+    } else if (c != '\r') {
+      if (wrap && ((cursor_x + textsize_x * 6) > _width)) {
+        cursor_x = 0;
+        cursor_y += textsize_y * 8;
+      }
+      drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+      cursor_x += textsize_x * 6;
+    }
+    return 1;
+  }
+
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += (int16_t)textsize_y * gfxFont->yAdvance;
+  } else if (c != '\r') {
+    uint8_t first = gfxFont->first;
+    if ((c >= first) && (c <= gfxFont->last)) {
+      const GFXglyph *glyph = &gfxFont->glyph[c - first];
+      uint8_t w = glyph->width, h = glyph->height;
+      if ((w > 0) && (h > 0)) {
+        int16_t xo = glyph->xOffset;
+        if (wrap && ((cursor_x + textsize_x * (xo + w)) > _width)) {
+          cursor_x = 0;
+          cursor_y += (int16_t)textsize_y * gfxFont->yAdvance;
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+      }
+      cursor_x += glyph->xAdvance * (int16_t)textsize_x;
+    }
+  }
+  return 1;
+}
+
+void Adafruit_GFX::setTextSize(uint8_t s) {
+  setTextSize(s, s);
+}
+
+void Adafruit_GFX::setTextSize(uint8_t s_x, uint8_t s_y) {
+  textsize_x = (s_x > 0) ? s_x : 1;
+  textsize_y = (s_y > 0) ? s_y : 1;
+}
+
+void Adafruit_GFX::setRotation(uint8_t x) {
+  rotation = (x & 3);
+  switch (rotation) {
+  case 0:
+  case 2:
+    _width = WIDTH;
+    _height = HEIGHT;
+    break;
+  case 1:
+  case 3:
+    _width = HEIGHT;
+    _height = WIDTH;
+    break;
+  }
+}
+
+void Adafruit_GFX::invertDisplay(bool i) {
+}
+
+/* Adafruit_GFX::setFont()
+    Switching between the classic font (drawn from the top) and a GFXfont (drawn from the baseline) moves the
+    cursor by 6 pixels, so text stays roughly where it was
+*/
+void Adafruit_GFX::setFont(const GFXfont *f) {
+  if (f) {
+    if (!gfxFont)
+      cursor_y += 6;
+  } else if (gfxFont) {
+    cursor_y -= 6;
+  }
+  gfxFont = (GFXfont *)f;
+}
+
+/* Adafruit_GFX::charBounds()
+    Extend the bounds by a character at x, y and move x, y on as write() would
+*/
+void Adafruit_GFX::charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx,
+                              int16_t *maxy) {
+  if (gfxFont) {
+    if (c == '\n') {
+      *x = 0;
+      *y += textsize_y * gfxFont->yAdvance;
+    } else if (c != '\r') {
+      uint8_t first = gfxFont->first, last = gfxFont->last;
+      if ((c >= first) && (c <= last)) {
+        const GFXglyph *glyph = &gfxFont->glyph[c - first];
+        uint8_t gw = glyph->width, gh = glyph->height, xa = glyph->xAdvance;
+        int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+        if (wrap && ((*x + (((int16_t)xo + gw) * textsize_x)) > _width)) {
+          *x = 0;
+          *y += textsize_y * gfxFont->yAdvance;
+        }
+        int16_t tsx = (int16_t)textsize_x, tsy = (int16_t)textsize_y;
+        int16_t x1 = *x + xo * tsx, y1 = *y + yo * tsy, x2 = x1 + gw * tsx - 1, y2 = y1 + gh * tsy - 1;
+        if (x1 < *minx)
+          *minx = x1;
+        if (y1 < *miny)
+          *miny = y1;
+        if (x2 > *maxx)
+          *maxx = x2;
+        if (y2 > *maxy)
+          *maxy = y2;
+        *x += xa * tsx;
+      }
+    }
+    return;
+  }
+
+  if (c == '\n') {
+    *x = 0;
+    *y += textsize_y * 8;
+  } else if (c != '\r') {
+    if (wrap && ((*x + textsize_x * 6) > _width)) {
+      *x = 0;
+      *y += textsize_y * 8;
+    }
+    int x2 = *x + textsize_x * 6 - 1, y2 = *y + textsize_y * 8 - 1;
+    if (x2 > *maxx)
+      *maxx = x2;
+    if (y2 > *maxy)
+      *maxy = y2;
+    if (*x < *minx)
+      *minx = *x;
+    if (*y < *miny)
+      *miny = *y;
+    *x += textsize_x * 6;
+  }
+}
+
+/* Adafruit_GFX::getTextBounds()
+    Bounding box of a string printed at x, y with the current font, size and wrapping
+*/
+void Adafruit_GFX::getTextBounds(const char *str, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w,
+                                 uint16_t *h) {
+  uint8_t c;
+  int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+
+  *x1 = x;
+  *y1 = y;
+  *w = *h = 0;
+  while ((c = *str++))
+    charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+
+  if (maxx >= minx) {
+    *x1 = minx;
+    *w = maxx - minx + 1;
+  }
+  if (maxy >= miny) {
+    *y1 = miny;
+    *h = maxy - miny + 1;
+  }
+}
+
+void Adafruit_GFX::getTextBounds(const String &str, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w,
+                                 uint16_t *h) {
+  getTextBounds(str.c_str(), x, y, x1, y1, w, h);
+}
+
+/* GFXcanvas1::GFXcanvas1()
+    Class object constructor, the buffer starts all black (0)
+  Parameters:
+    uint16_t w, h: canvas size in pixels
+  Returns: None
+*/
+GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+  uint32_t bytes = ((w + 7) / 8) * h;
+  if ((buffer = (uint8_t *)malloc(bytes)))
+    memset(buffer, 0, bytes);
+}
+
+GFXcanvas1::~GFXcanvas1(void) {
+  free(buffer);
+}
+
+void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (buffer == NULL || (x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+    return;
+
+  int16_t t;
+  switch (rotation) {
+  case 1:
+    t = x;
+    x = WIDTH - 1 - y;
+    y = t;
+    break;
+  case 2:
+    x = WIDTH - 1 - x;
+    y = HEIGHT - 1 - y;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = HEIGHT - 1 - t;
+    break;
+  }
+
+  uint8_t *ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+  if (color)
+    *ptr |= 0x80 >> (x & 7);
+  else
+    *ptr &= ~(0x80 >> (x & 7));
+}
+
+bool GFXcanvas1::getPixel(int16_t x, int16_t y) const {
+  int16_t t;
+  switch (rotation) {
+  case 1:
+    t = x;
+    x = WIDTH - 1 - y;
+    y = t;
+    break;
+  case 2:
+    x = WIDTH - 1 - x;
+    y = HEIGHT - 1 - y;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = HEIGHT - 1 - t;
+    break;
+  }
+  return getRawPixel(x, y);
+}
+
+bool GFXcanvas1::getRawPixel(int16_t x, int16_t y) const {
+  if ((x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT) || buffer == NULL)
+    return false;
+  return buffer[(x / 8) + y * ((WIDTH + 7) / 8)] & (0x80 >> (x & 7));
+}
+
+void GFXcanvas1::fillScreen(uint16_t color) {
+  if (buffer)
+    memset(buffer, color ? 0xFF : 0x00, ((WIDTH + 7) / 8) * HEIGHT);
+}
+
+/* GFXcanvas1::drawFastVLine()
+    Clip the line to the canvas and draw it straight into the buffer
+*/
+void GFXcanvas1::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if (h < 0) {    // convert negative heights to positive equivalent
+    h *= -1;
+    y -= h - 1;
+    if (y < 0) {
+      h += y;
+      y = 0;
+    }
+  }
+
+  if ((x < 0) || (x >= width()) || (y >= height()) || ((y + h - 1) < 0))
+    return;
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (y + h > height())
+    h = height() - y;
+
+  int16_t t;
+  switch (rotation) {
+  case 0:
+    drawFastRawVLine(x, y, h, color);
+    break;
+  case 1:
+    t = x;
+    x = WIDTH - 1 - y;
+    y = t;
+    x -= h - 1;
+    drawFastRawHLine(x, y, h, color);
+    break;
+  case 2:
+    x = WIDTH - 1 - x;
+    y = HEIGHT - 1 - y;
+    y -= h - 1;
+    drawFastRawVLine(x, y, h, color);
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = HEIGHT - 1 - t;
+    drawFastRawHLine(x, y, h, color);
+    break;
+  }
+}
+
+/* GFXcanvas1::drawFastHLine()
+    Clip the line to the canvas and draw it straight into the buffer
+*/
+void GFXcanvas1::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (w < 0) {    // convert negative widths to positive equivalent
+    w *= -1;
+    x -= w - 1;
+    if (x < 0) {
+      w += x;
+      x = 0;
+    }
+  }
+
+  if ((y < 0) || (y >= height()) || (x >= width()) || ((x + w - 1) < 0))
+    return;
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (x + w >= width())
+    w = width() - x;
+
+  int16_t t;
+  switch (rotation) {
+  case 0:
+    drawFastRawHLine(x, y, w, color);
+    break;
+  case 1:
+    t = x;
+    x = WIDTH - 1 - y;
+    y = t;
+    drawFastRawVLine(x, y, w, color);
+    break;
+  case 2:
+    x = WIDTH - 1 - x;
+    y = HEIGHT - 1 - y;
+    x -= w - 1;
+    drawFastRawHLine(x, y, w, color);
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = HEIGHT - 1 - t;
+    y -= w - 1;
+    drawFastRawVLine(x, y, w, color);
+    break;
+  }
+}
+
+void GFXcanvas1::drawFastRawVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  int16_t row_bytes = (WIDTH + 7) / 8;
+  uint8_t *ptr = &buffer[(x / 8) + y * row_bytes];
+  uint8_t mask = 0x80 >> (x & 7);
+
+  for (int16_t i = 0; i < h; i++, ptr += row_bytes) {
+    if (color)
+      *ptr |= mask;
+    else
+      *ptr &= ~mask;
+  }
+}
+
+/* GFXcanvas1::drawFastRawHLine()
+    Set or clear w bits from x on, the partial bytes at both ends bit by bit, the whole bytes in between at once
+*/
+void GFXcanvas1::drawFastRawHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  uint8_t *row = &buffer[y * ((WIDTH + 7) / 8)];
+  int16_t end = x + w;    // exclusive
+
+  while (x < end && (x & 7)) {
+    drawFastRawVLine(x++, y, 1, color);
+  }
+  if (x + 8 <= end) {
+    int16_t bytes = (end - x) / 8;
+    memset(&row[x / 8], color ? 0xFF : 0x00, bytes);
+    x += bytes * 8;
+  }
+  while (x < end) {
+    drawFastRawVLine(x++, y, 1, color);
+  }
+}
@@ -0,0 +1,465 @@
+/* Host implementation of the Arduino core stand-in (native/include/Arduino.h): String, Print and Stream, Serial on
+    stdout, the clock, pins, the heap figures of ESP and deep sleep.
+*/
+
+#include <Arduino.h>
+#include <unistd.h>
+#include "hostHeap.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+const uint32_t HOST_HEAP_SIZE = 320 * 1024;   // about what an ESP32 running wifi starts out with
+
+static esp_sleep_wakeup_cause_t wakeup_cause = ESP_SLEEP_WAKEUP_UNDEFINED;
+static uint64_t sleep_timer_us = 0;
+static uint32_t min_free_heap = HOST_HEAP_SIZE;
+
+#ifdef HOST_STRLCPY
+/* strlcpy()
+    Copy a string, truncated to fit size - 1 characters, always terminated (if size > 0)
+  Returns:
+    size_t: length of src
+*/
+size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+
+  if (size > 0) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+
+/* strlcat()
+    Append a string, truncated to fit size - 1 characters in total, always terminated
+  Returns:
+    size_t: length the string would have had without truncation
+*/
+size_t strlcat(char *dst, const char *src, size_t size) {
+  size_t used = strnlen(dst, size);
+
+  if (used == size)
+    return size + strlen(src);
+  return used + strlcpy(dst + used, src, size - used);
+}
+#endif
+
+/* String
+    Only what is needed to keep the semantics of the ESP32 core: strings of up to SSO_SIZE - 1 characters don't
+    allocate, longer ones allocate their buffer (and reallocate it when they grow past its capacity).
+*/
+String::String(const char *cstr) : heap(NULL), capacity(SSO_SIZE - 1), len(0) {
+  sso[0] = '\0';
+  if (cstr != NULL)
+    assign(cstr, strlen(cstr));
+}
+
+String::String(const String &str) : String() {
+  assign(str.c_str(), str.len);
+}
+
+String::String(String &&str) : heap(str.heap), capacity(str.capacity), len(str.len) {
+  memcpy(sso, str.sso, sizeof(sso));
+  str.heap = NULL;
+  str.capacity = SSO_SIZE - 1;
+  str.len = 0;
+  str.sso[0] = '\0';
+}
+
+String::String(char c) : String() {
+  assign(&c, 1);
+}
+
+String::String(unsigned char value, unsigned char base) : String((unsigned long)value, base) {}
+String::String(int value, unsigned char base) : String((long)value, base) {}
+String::String(unsigned int value, unsigned char base) : String((unsigned long)value, base) {}
+
+String::String(long value, unsigned char base) : String() {
+  if (value < 0 && base == 10) {
+    char text[24];
+    assign(text, snprintf(text, sizeof(text), "%ld", value));
+  } else {
+    *this = String((unsigned long)value, base);
+  }
+}
+
+String::String(unsigned long value, unsigned char base) : String() {
+  char digits[8 * sizeof(unsigned long) + 1];
+  char *p = digits + sizeof(digits) - 1;
+
+  if (base < 2)
+    base = 10;
+  *p = '\0';
+  do {
+    unsigned d = value % base;
+    *--p = d < 10 ? '0' + d : 'a' + d - 10;
+    value /= base;
+  } while (value > 0);
+  assign(p, digits + sizeof(digits) - 1 - p);
+}
+
+String::String(float value, unsigned int decimals) : String((double)value, decimals) {}
+
+String::String(double value, unsigned int decimals) : String() {
+  char text[48];
+  int n = snprintf(text, sizeof(text), "%.*f", decimals, value);
+  assign(text, n < (int)sizeof(text) ? n : sizeof(text) - 1);
+}
+
+String::~String() {
+  free(heap);
+}
+
+String &String::operator=(const String &rhs) {
+  if (this != &rhs)
+    assign(rhs.c_str(), rhs.len);
+  return *this;
+}
+
+String &String::operator=(String &&rhs) {
+  if (this != &rhs) {
+    free(heap);
+    heap = rhs.heap;
+    capacity = rhs.capacity;
+    len = rhs.len;
+    memcpy(sso, rhs.sso, sizeof(sso));
+    rhs.heap = NULL;
+    rhs.capacity = SSO_SIZE - 1;
+    rhs.len = 0;
+    rhs.sso[0] = '\0';
+  }
+  return *this;
+}
+
+String &String::operator=(const char *cstr) {
+  assign(cstr != NULL ? cstr : "", cstr != NULL ? strlen(cstr) : 0);
+  return *this;
+}
+
+/* String::reserve()
+    Make room for size characters
+  Returns:
+    bool: false if the buffer couldn't be allocated
+*/
+bool String::reserve(unsigned int size) {
+  if (size <= capacity)
+    return true;
+
+  char *grown = (char *)realloc(heap, size + 1);
+  if (grown == NULL)
+    return false;
+  if (heap == NULL)
+    memcpy(grown, sso, len + 1);
+  heap = grown;
+  capacity = size;
+  return true;
+}
+
+void String::assign(const char *cstr, unsigned int length) {
+  if (!reserve(length)) {
+    len = 0;
+    buffer()[0] = '\0';
+    return;
+  }
+  memmove(buffer(), cstr, length);
+  len = length;
+  buffer()[len] = '\0';
+}
+
+bool String::concat(const char *cstr, unsigned int length) {
+  if (cstr == NULL)
+    return false;
+  if (length == 0)
+    return true;
+  if (cstr >= buffer() && cstr < buffer() + len) {   // appending a part of itself, which reserve() may move
+    String copy;
+    copy.assign(cstr, length);
+    return concat(copy.c_str(), length);
+  }
+  if (!reserve(len + length))
+    return false;
+  memcpy(buffer() + len, cstr, length);
+  len += length;
+  buffer()[len] = '\0';
+  return true;
+}
+
+bool String::equals(const char *cstr) const {
+  return strcmp(buffer(), cstr != NULL ? cstr : "") == 0;
+}
+
+bool String::equalsIgnoreCase(const String &str) const {
+  return len == str.len && strcasecmp(buffer(), str.c_str()) == 0;
+}
+
+bool String::startsWith(const String &prefix) const {
+  return prefix.len <= len && strncmp(buffer(), prefix.c_str(), prefix.len) == 0;
+}
+
+bool String::endsWith(const String &suffix) const {
+  return suffix.len <= len && strcmp(buffer() + len - suffix.len, suffix.c_str()) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+  if (from >= len)
+    return -1;
+  const char *found = strchr(buffer() + from, c);
+  return found != NULL ? found - buffer() : -1;
+}
+
+int String::indexOf(const char *str, unsigned int from) const {
+  if (from >= len)
+    return -1;
+  const char *found = strstr(buffer() + from, str);
+  return found != NULL ? found - buffer() : -1;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  String out;
+
+  if (from > to) {
+    unsigned int swap = from;
+    from = to;
+    to = swap;
+  }
+  if (from >= len)
+    return out;
+  if (to > len)
+    to = len;
+  out.assign(buffer() + from, to - from);
+  return out;
+}
+
+void String::toUpperCase() {
+  for (char *p = buffer(); *p; p++)
+    *p = toupper((unsigned char)*p);
+}
+
+void String::toLowerCase() {
+  for (char *p = buffer(); *p; p++)
+    *p = tolower((unsigned char)*p);
+}
+
+void String::trim() {
+  const char *start = buffer();
+  unsigned int n = len;
+
+  while (n > 0 && isspace((unsigned char)*start)) {
+    start++;
+    n--;
+  }
+  while (n > 0 && isspace((unsigned char)start[n - 1]))
+    n--;
+  assign(start, n);
+}
+
+String operator+(const String &lhs, const String &rhs) {
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator+(const String &lhs, const char *rhs) {
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator+(const char *lhs, const String &rhs) {
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator+(const String &lhs, char rhs) {
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+/* Print */
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size-- > 0)
+    n += write(*buffer++);
+  return n;
+}
+
+size_t Print::printf(const char *format, ...) {
+  char small[128];
+  va_list args;
+
+  va_start(args, format);
+  int len = vsnprintf(small, sizeof(small), format, args);
+  va_end(args);
+  if (len < 0)
+    return 0;
+  if (len < (int)sizeof(small))
+    return write((const uint8_t *)small, len);
+
+  char *large = (char *)malloc(len + 1);  // the ESP32 core allocates for long lines as well
+  if (large == NULL)
+    return 0;
+  va_start(args, format);
+  vsnprintf(large, len + 1, format, args);
+  va_end(args);
+  len = write((const uint8_t *)large, len);
+  free(large);
+  return len;
+}
+
+size_t Print::print(long value, int base) {
+  if (base == 10)
+    return printf("%ld", value);
+  return print(String((unsigned long)value, base));
+}
+
+size_t Print::print(unsigned long value, int base) {
+  return print(String(value, base));
+}
+
+size_t Print::print(double value, int digits) {
+  return printf("%.*f", digits, value);
+}
+
+/* Stream */
+size_t Stream::readBytes(char *buffer, size_t length) {
+  size_t n = 0;
+  int c;
+
+  while (n < length && (c = read()) >= 0)
+    buffer[n++] = c;
+  return n;
+}
+
+size_t Stream::readBytesUntil(char terminator, char *buffer, size_t length) {
+  size_t n = 0;
+  int c;
+
+  while (n < length && (c = read()) >= 0 && c != terminator)
+    buffer[n++] = c;
+  return n;
+}
+
+String Stream::readStringUntil(char terminator) {
+  String out;
+  int c;
+
+  while ((c = read()) >= 0 && c != terminator)
+    out += (char)c;
+  return out;
+}
+
+/* HardwareSerial, on stdout */
+size_t HardwareSerial::write(uint8_t c) {
+  return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  return fwrite(buffer, 1, size, stdout);
+}
+
+void HardwareSerial::flush() {
+  fflush(stdout);
+}
+
+/* Time, the host clock */
+static uint64_t monotonicUs(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static const uint64_t start_us = monotonicUs();
+
+int64_t esp_timer_get_time(void) {
+  return monotonicUs() - start_us;
+}
+
+unsigned long millis(void) {
+  return esp_timer_get_time() / 1000;
+}
+
+unsigned long micros(void) {
+  return esp_timer_get_time();
+}
+
+  // Nothing on the host is waited for, a delay only costs time a profile doesn't want to see
+void delay(unsigned long ms) {}
+void delayMicroseconds(unsigned int us) {}
+void yield(void) {}
+
+/* Pins, nothing is connected */
+void pinMode(uint8_t pin, uint8_t mode) {}
+void digitalWrite(uint8_t pin, uint8_t value) {}
+int digitalRead(uint8_t pin) {
+  return LOW;
+}
+
+uint16_t analogRead(uint8_t pin) {
+  return 2048;    // 3.9 V behind the battery divider (halved), see esp_adc_cal_characterize()
+}
+
+long random(long max) {
+  return max > 0 ? rand() % max : 0;
+}
+
+long random(long min, long max) {
+  return min < max ? min + random(max - min) : min;
+}
+
+/* EspClass, the heap is the host heap as far as hostHeap.cpp tracks it */
+uint32_t EspClass::getHeapSize(void) {
+  return HOST_HEAP_SIZE;
+}
+
+uint32_t EspClass::getFreeHeap(void) {
+  size_t used = hostHeapStats().in_use;
+  uint32_t free_heap = used < HOST_HEAP_SIZE ? HOST_HEAP_SIZE - used : 0;
+
+  if (free_heap < min_free_heap)
+    min_free_heap = free_heap;
+  return free_heap;
+}
+
+uint32_t EspClass::getMinFreeHeap(void) {
+  size_t peak = hostHeapStats().peak;
+  uint32_t low = peak < HOST_HEAP_SIZE ? HOST_HEAP_SIZE - peak : 0;
+  return low < min_free_heap ? low : min_free_heap;
+}
+
+uint32_t EspClass::getMaxAllocHeap(void) {
+  return getFreeHeap();
+}
+
+void EspClass::restart(void) {
+  fflush(stdout);
+  exit(1);
+}
+
+/* Sleep */
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause(void) {
+  return wakeup_cause;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us) {
+  sleep_timer_us = time_in_us;
+  return ESP_OK;
+}
+
+  // Deep sleep ends the program, the atexit() handlers of the host main report on the wake
+void esp_deep_sleep_start(void) {
+  fflush(stdout);
+  exit(0);
+}
+
+void hostSetWakeupCause(esp_sleep_wakeup_cause_t cause) {
+  wakeup_cause = cause;
+}
+
+uint64_t hostSleepTimer(void) {
+  return sleep_timer_us;
+}
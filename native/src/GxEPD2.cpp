@@ -0,0 +1,123 @@
+/* Host stand-in for the GxEPD2 panel driver ([env:native]), see GxEPD2.h
+*/
+
+#include "GxEPD2.h"
+
+const GxEPD2_EPD *GxEPD2_EPD::refreshed = NULL;
+
+/* GxEPD2_EPD::GxEPD2_EPD()
+    Class object constructor, the panel starts out white
+  Parameters:
+    uint16_t w, h: panel size in pixels, at most 400x300
+  Returns: None
+*/
+GxEPD2_EPD::GxEPD2_EPD(uint16_t w, uint16_t h) : WIDTH(w), HEIGHT(h) {
+  memset(ram, 0xFF, sizeof(ram));
+  memset(screen, 0xFF, sizeof(screen));
+}
+
+/* GxEPD2_EPD::writeScreenBuffer()
+    Fill the controller RAM with a byte value (0xFF = white)
+*/
+void GxEPD2_EPD::writeScreenBuffer(uint8_t value) {
+  memset(ram, value, WIDTH / 8 * HEIGHT);
+  bytes_written += WIDTH / 8 * HEIGHT;
+}
+
+void GxEPD2_EPD::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert,
+                            bool mirror_y, bool pgm) {
+  writeWindow(bitmap, 0, 0, w, h, x, y, w, h, invert, mirror_y);
+}
+
+void GxEPD2_EPD::writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap,
+                                int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h, bool invert,
+                                bool mirror_y, bool pgm) {
+  writeWindow(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y);
+}
+
+  // The "Again" writes fill the controller's previous image RAM, for differential refreshes. The host panel only
+  // keeps the new image, so they count the bytes and leave it.
+void GxEPD2_EPD::writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert,
+                                 bool mirror_y, bool pgm) {
+  bytes_written += (w + 7) / 8 * h;
+}
+
+void GxEPD2_EPD::writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap,
+                                     int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h, bool invert,
+                                     bool mirror_y, bool pgm) {
+  bytes_written += (w + 7) / 8 * h;
+}
+
+/* GxEPD2_EPD::refresh()
+    Show the whole controller RAM
+  Parameters:
+    bool partial_update_mode: refresh without the full refresh waveform
+  Returns: None
+*/
+void GxEPD2_EPD::refresh(bool partial_update_mode) {
+  if (partial_update_mode)
+    partial_refreshes++;
+  else
+    full_refreshes++;
+  memcpy(screen, ram, WIDTH / 8 * HEIGHT);
+  refreshed = this;
+}
+
+/* GxEPD2_EPD::refresh()
+    Show a window of the controller RAM, widened to whole bytes like the controller does
+  Parameters:
+    int16_t x, y, w, h: window to refresh
+  Returns: None
+*/
+void GxEPD2_EPD::refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+  int16_t x1 = max(x, (int16_t)0) / 8;
+  int16_t x2 = (min((int16_t)(x + w), (int16_t)WIDTH) + 7) / 8;
+  int16_t y1 = max(y, (int16_t)0);
+  int16_t y2 = min((int16_t)(y + h), (int16_t)HEIGHT);
+
+  partial_refreshes++;
+  refreshed = this;
+  for (int16_t row = y1; row < y2 && x2 > x1; row++) {
+    memcpy(&screen[row * (WIDTH / 8) + x1], &ram[row * (WIDTH / 8) + x1], x2 - x1);
+  }
+}
+
+/* GxEPD2_EPD::writeWindow()
+    Write a part of a bitmap to the controller RAM, as the driver does it: the window is widened to whole bytes and
+    clipped to the panel.
+  Parameters:
+    const uint8_t bitmap[]: bitmap of w_bitmap x h_bitmap, rows padded to whole bytes, 1 = white
+    int16_t x_part, y_part: upper left corner of the part in the bitmap
+    int16_t x, y, w, h: where the part goes on the panel and its size
+    bool invert: write the bitmap inverted
+    bool mirror_y: the bitmap is upside down
+  Returns: None
+*/
+void GxEPD2_EPD::writeWindow(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap,
+                             int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h, bool invert,
+                             bool mirror_y) {
+  if (w_bitmap < 0 || h_bitmap < 0 || w < 0 || h < 0)
+    return;
+  if (x_part < 0 || x_part >= w_bitmap || y_part < 0 || y_part >= h_bitmap)
+    return;
+
+  int16_t wb_bitmap = (w_bitmap + 7) / 8;
+  x_part -= x_part % 8;
+  w = min(w, (int16_t)(w_bitmap - x_part));
+  h = min(h, (int16_t)(h_bitmap - y_part));
+  x -= x % 8;
+  w = 8 * ((w + 7) / 8);
+
+  int16_t x1 = max(x, (int16_t)0), y1 = max(y, (int16_t)0);
+  int16_t x2 = min((int16_t)(x + w), (int16_t)WIDTH), y2 = min((int16_t)(y + h), (int16_t)HEIGHT);
+  int16_t dx = x1 - x, dy = y1 - y;
+
+  for (int16_t i = 0; i < y2 - y1; i++) {
+    int16_t row = mirror_y ? h_bitmap - 1 - (y_part + i + dy) : y_part + i + dy;
+    for (int16_t j = 0; j < (x2 - x1) / 8; j++) {
+      uint8_t data = bitmap[x_part / 8 + dx / 8 + j + row * wb_bitmap];
+      ram[(y1 + i) * (WIDTH / 8) + x1 / 8 + j] = invert ? ~data : data;
+      bytes_written++;
+    }
+  }
+}
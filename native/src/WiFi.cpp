@@ -0,0 +1,88 @@
+/* Host implementation of the WiFi library stand-in (native/include/WiFi.h): every connect succeeds at once, with
+    the configured static addresses or made up DHCP ones.
+*/
+
+#include <WiFi.h>
+
+WiFiClass WiFi;
+
+/* IPAddress::toString()
+  Returns:
+    String: the address in dotted decimal
+*/
+String IPAddress::toString() const {
+  char text[16];
+
+  snprintf(text, sizeof(text), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+  return String(text);
+}
+
+/* WiFiClass::begin()
+    Join the network, the connected and got-ip events are raised before this returns
+  Returns:
+    wl_status_t: WL_CONNECTED
+*/
+wl_status_t WiFiClass::begin(const char *ssid, const char *passphrase, int32_t channel, const uint8_t *bssid,
+                             bool connect) {
+  if (channel != 0)
+    channel_ = channel;
+  if (bssid != NULL)
+    memcpy(this->bssid, bssid, sizeof(this->bssid));
+  if (ip == IPAddress()) {    // DHCP
+    ip = IPAddress(192, 168, 1, 42);
+    gateway = IPAddress(192, 168, 1, 1);
+    subnet = IPAddress(255, 255, 255, 0);
+    dns = gateway;
+  }
+  state = WL_CONNECTED;
+  raise(ARDUINO_EVENT_WIFI_STA_CONNECTED);
+  raise(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  return state;
+}
+
+/* WiFiClass::config()
+    Static addresses for the next begin(), all 0 goes back to DHCP
+*/
+bool WiFiClass::config(IPAddress local_ip, IPAddress gateway, IPAddress subnet, IPAddress dns1, IPAddress dns2) {
+  ip = local_ip;
+  this->gateway = gateway;
+  this->subnet = subnet;
+  dns = dns1;
+  return true;
+}
+
+bool WiFiClass::disconnect(bool wifioff, bool eraseap) {
+  if (state == WL_CONNECTED) {
+    state = WL_DISCONNECTED;
+    raise(ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+  }
+  return true;
+}
+
+bool WiFiClass::mode(wifi_mode_t mode) {
+  if (mode == WIFI_OFF)
+    disconnect();
+  return true;
+}
+
+/* WiFiClass::onEvent()
+    Register a handler for an event
+  Returns:
+    wifi_event_id_t: id of the handler, 0 if there are too many
+*/
+wifi_event_id_t WiFiClass::onEvent(WiFiEventFuncCb cb, arduino_event_id_t event) {
+  if (handler_count == MAX_HANDLERS)
+    return 0;
+  handlers[handler_count] = cb;
+  handler_events[handler_count] = event;
+  return ++handler_count;
+}
+
+void WiFiClass::raise(arduino_event_id_t event) {
+  WiFiEventInfo_t info = {0};
+
+  for (int i = 0; i < handler_count; i++) {
+    if (handler_events[i] == event)
+      handlers[i](event, info);
+  }
+}
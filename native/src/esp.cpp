@@ -0,0 +1,50 @@
+/* Host implementation of the ESP-IDF functions the firmware uses besides sleep (see Arduino.cpp): the battery ADC
+    calibration and the time sync, which finds the host clock already set.
+*/
+
+#include <Arduino.h>
+#include "esp_adc_cal.h"
+#include "esp_sntp.h"
+
+static sntp_sync_time_cb_t sntp_callback = NULL;
+
+/* esp_adc_cal_characterize()
+    11 dB attenuation over 12 bits is taken as linear up to 3.9 V, there is no eFuse calibration on a PC
+  Returns:
+    esp_adc_cal_value_t: ESP_ADC_CAL_VAL_DEFAULT_VREF
+*/
+esp_adc_cal_value_t esp_adc_cal_characterize(adc_unit_t adc_num, adc_atten_t atten, adc_bits_width_t bit_width,
+                                             uint32_t default_vref, esp_adc_cal_characteristics_t *chars) {
+  chars->adc_num = adc_num;
+  chars->atten = atten;
+  chars->bit_width = bit_width;
+  chars->vref = default_vref;
+  chars->coeff_a = 3900;    // mV at full scale, 11 dB attenuation
+  chars->coeff_b = 0;
+  return ESP_ADC_CAL_VAL_DEFAULT_VREF;
+}
+
+uint32_t esp_adc_cal_raw_to_voltage(uint32_t adc_reading, const esp_adc_cal_characteristics_t *chars) {
+  return adc_reading * chars->coeff_a / 4095 + chars->coeff_b;
+}
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) {
+  sntp_callback = callback;
+}
+
+/* configTime()
+    The host clock is right already, the sync completes at once
+*/
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char *server1, const char *server2,
+                const char *server3) {
+  struct timeval tv;
+
+  gettimeofday(&tv, NULL);
+  if (sntp_callback != NULL)
+    sntp_callback(&tv);
+}
+
+bool getLocalTime(struct tm *info, uint32_t ms) {
+  time_t now = time(NULL);
+  return localtime_r(&now, info) != NULL;
+}
@@ -0,0 +1,69 @@
+/* Host implementation of the FreeRTOS stand-in (native/include/freertos/). The host runs a single thread: a task
+    runs to completion inside xTaskCreate...(), so its event group bits are set by the time anyone waits for them.
+*/
+
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+
+/* xTaskCreatePinnedToCore()
+    Run the task now, to completion
+  Returns:
+    BaseType_t: pdPASS
+*/
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char *name, uint32_t stack_depth, void *param,
+                                   UBaseType_t priority, TaskHandle_t *created, BaseType_t core) {
+  if (created != NULL)
+    *created = NULL;
+  code(param);
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stack_depth, void *param,
+                       UBaseType_t priority, TaskHandle_t *created) {
+  return xTaskCreatePinnedToCore(code, name, stack_depth, param, priority, created, tskNO_AFFINITY);
+}
+
+  // The task has returned from its function already, which is as good as deleted
+void vTaskDelete(TaskHandle_t task) {}
+void vTaskDelay(TickType_t ticks) {}
+
+/* Event groups, a bit mask each */
+EventGroupHandle_t xEventGroupCreate(void) {
+  return calloc(1, sizeof(EventBits_t));
+}
+
+void vEventGroupDelete(EventGroupHandle_t group) {
+  free(group);
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits) {
+  return *(EventBits_t *)group |= bits;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits) {
+  EventBits_t before = *(EventBits_t *)group;
+  *(EventBits_t *)group &= ~bits;
+  return before;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group) {
+  return *(EventBits_t *)group;
+}
+
+/* xEventGroupWaitBits()
+    Nothing can set a bit while the caller waits, so this returns at once with the bits that are set. Bits waited
+    for are cleared only if the wait succeeded, as FreeRTOS does.
+  Returns:
+    EventBits_t: the bits of the group
+*/
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+                                BaseType_t wait_for_all, TickType_t ticks) {
+  EventBits_t set = *(EventBits_t *)group;
+  bool done = wait_for_all ? (set & bits) == bits : (set & bits) != 0;
+
+  if (done && clear_on_exit)
+    *(EventBits_t *)group &= ~bits;
+  return set;
+}
@@ -0,0 +1,8 @@
+/* Host stand-ins of the Adafruit GFX fonts the firmware uses ([env:native]), see Fonts/FreeMonoBold12pt7b.h
+*/
+
+#include <Adafruit_GFX.h>
+#include "fonts.h"
+
+extern const GFXfont FreeMonoBold12pt7b = DejaVu_Sans_Bold_11;
+extern const GFXfont FreeMonoBold9pt7b = DejaVu_Sans_Bold_11;
@@ -0,0 +1,135 @@
+/* Heap tracking for [env:native] (see hostHeap.h). On glibc malloc(), calloc(), realloc(), free() and the aligned
+    allocators are replaced by wrappers that count the bytes in use (as malloc_usable_size() reports them) and
+    hand the work on to glibc's own implementation. The program is single threaded, so there is no locking.
+*/
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hostHeap.h"
+
+static HostHeapStats stats;
+
+#ifdef __GLIBC__
+#include <malloc.h>
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+void __libc_free(void *ptr);
+}
+
+/* allocated()
+    Count a new block.
+  Parameters:
+    void *ptr: the block, NULL = the allocation failed
+  Returns:
+    void *: ptr
+*/
+static void *allocated(void *ptr) {
+  if (ptr != NULL) {
+    stats.in_use += malloc_usable_size(ptr);
+    stats.allocations++;
+    if (stats.in_use > stats.peak)
+      stats.peak = stats.in_use;
+  }
+  return ptr;
+}
+
+extern "C" void *malloc(size_t size) {
+  return allocated(__libc_malloc(size));
+}
+
+extern "C" void *calloc(size_t count, size_t size) {
+  return allocated(__libc_calloc(count, size));
+}
+
+extern "C" void *memalign(size_t alignment, size_t size) {
+  return allocated(__libc_memalign(alignment, size));
+}
+
+extern "C" void *aligned_alloc(size_t alignment, size_t size) {
+  return allocated(__libc_memalign(alignment, size));
+}
+
+extern "C" int posix_memalign(void **ptr, size_t alignment, size_t size) {
+  *ptr = allocated(__libc_memalign(alignment, size));
+  return *ptr != NULL ? 0 : ENOMEM;
+}
+
+extern "C" void free(void *ptr) {
+  if (ptr != NULL)
+    stats.in_use -= malloc_usable_size(ptr);
+  __libc_free(ptr);
+}
+
+  // A realloc() that has to grow the block is counted as an allocation, as it is one on the ESP32
+extern "C" void *realloc(void *ptr, size_t size) {
+  size_t before = (ptr != NULL) ? malloc_usable_size(ptr) : 0;
+  void *moved = __libc_realloc(ptr, size);
+
+  if (moved == NULL) {
+    if (ptr != NULL && size == 0)     // glibc freed the block
+      stats.in_use -= before;
+    return NULL;
+  }
+  stats.in_use = stats.in_use - before + malloc_usable_size(moved);
+  if (size > before)
+    stats.allocations++;
+  if (stats.in_use > stats.peak)
+    stats.peak = stats.in_use;
+  return moved;
+}
+
+/* hostUntrackedAlloc()
+    Allocate outside the tracked heap, for host stand-ins whose memory the device doesn't spend (zlib's state).
+  Parameters:
+    size_t size: bytes to allocate
+  Returns:
+    void *: the block, NULL if out of memory
+*/
+void *hostUntrackedAlloc(size_t size) {
+  return __libc_malloc(size);
+}
+
+/* hostUntrackedFree()
+    Release a block of hostUntrackedAlloc()
+  Parameters:
+    void *ptr: the block, NULL is ignored
+  Returns: None
+*/
+void hostUntrackedFree(void *ptr) {
+  __libc_free(ptr);
+}
+
+#else
+
+void *hostUntrackedAlloc(size_t size) {
+  return malloc(size);
+}
+
+void hostUntrackedFree(void *ptr) {
+  free(ptr);
+}
+
+#endif
+
+/* hostHeapReset()
+    Start a new measurement: the peak drops to what is in use now and the allocation count to 0.
+  Parameters: None
+  Returns: None
+*/
+void hostHeapReset(void) {
+  stats.peak = stats.in_use;
+  stats.allocations = 0;
+}
+
+/* hostHeapStats()
+  Returns:
+    HostHeapStats: heap in use, its peak and the allocations since the last hostHeapReset()
+*/
+HostHeapStats hostHeapStats(void) {
+  return stats;
+}
@@ -0,0 +1,52 @@
+/* Program entry of [env:native]: runs the firmware like the Arduino core does, setup() and then loop(). With the
+    flags of [env:native] setup() renders the fixture through displayInformation() and goes to deep sleep, which
+    ends the program. On the way out the image the panel shows is written as a PNG (render.png, or the file given
+    as the first argument) and the panel and heap figures of the run are printed.
+
+    pio run -e native -t exec
+*/
+
+#ifndef PIO_UNIT_TESTING
+
+#include <Arduino.h>
+#include <GxEPD2.h>
+#include "hostHeap.h"
+#include "hostPng.h"
+
+void setup(void);
+void loop(void);
+
+static const char *png_path = "render.png";
+
+  // atexit() handler, deep sleep and the end of main() both come here
+static void reportRun(void) {
+  const GxEPD2_EPD *panel = GxEPD2_EPD::refreshed;
+  HostHeapStats heap = hostHeapStats();
+
+  fflush(stdout);
+  printf("Heap: %u bytes peak, %u allocations, %u bytes still in use\n", (unsigned)heap.peak,
+         (unsigned)heap.allocations, (unsigned)heap.in_use);
+  if (panel == NULL) {
+    printf("Panel: not refreshed, no image written\n");
+    return;
+  }
+  printf("Panel: %u full and %u partial refreshes, %u bytes written\n", (unsigned)panel->full_refreshes,
+         (unsigned)panel->partial_refreshes, (unsigned)panel->bytes_written);
+  if (hostWritePng(png_path, panel->shown(), panel->WIDTH, panel->HEIGHT))
+    printf("Panel image written to %s\n", png_path);
+  else
+    printf("Unable to write %s\n", png_path);
+}
+
+int main(int argc, char *argv[]) {
+  if (argc > 1)
+    png_path = argv[1];
+  atexit(reportRun);
+  hostHeapReset();
+
+  setup();
+  for (;;)
+    loop();
+}
+
+#endif
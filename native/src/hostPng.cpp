@@ -0,0 +1,139 @@
+/* PNG files of [env:native]: a 1 bit per pixel image in the layout of the panel RAM (rows of whole bytes, MSB
+    first, 1 = white) is exactly a PNG of 1 bit greyscale, only a filter byte has to go in front of each row.
+    hostReadPng() reads back what hostWritePng() writes, not PNG files in general.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include "hostPng.h"
+
+static const uint8_t SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+
+static uint32_t get32(const uint8_t *p) {
+  return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static void put32(uint8_t *p, uint32_t value) {
+  p[0] = value >> 24;
+  p[1] = value >> 16;
+  p[2] = value >> 8;
+  p[3] = value;
+}
+
+  // A chunk is its length, type, data and the crc32 over type and data
+static bool writeChunk(FILE *f, const char *type, const uint8_t *data, uint32_t len) {
+  uint8_t head[8], tail[4];
+  uint32_t crc = crc32(0, (const Bytef *)type, 4);
+
+  put32(head, len);
+  memcpy(head + 4, type, 4);
+  if (len > 0)
+    crc = crc32(crc, data, len);
+  put32(tail, crc);
+  return fwrite(head, 1, 8, f) == 8 && (len == 0 || fwrite(data, 1, len, f) == len) && fwrite(tail, 1, 4, f) == 4;
+}
+
+/* hostWritePng()
+    Write a 1 bit per pixel bitmap as a PNG file
+  Parameters:
+    const char *path: file to write
+    const uint8_t *bitmap: width x height pixels, rows padded to whole bytes, MSB first, 1 = white
+    uint16_t width, height: size in pixels
+  Returns:
+    bool: true if the file was written
+*/
+bool hostWritePng(const char *path, const uint8_t *bitmap, uint16_t width, uint16_t height) {
+  size_t row_bytes = (width + 7) / 8;
+  size_t raw_len = (row_bytes + 1) * height;
+  uLongf packed_len = compressBound(raw_len);
+  uint8_t *raw = (uint8_t *)malloc(raw_len);
+  uint8_t *packed = (uint8_t *)malloc(packed_len);
+  uint8_t header[13];
+  bool ok = false;
+
+  if (raw != NULL && packed != NULL) {
+    for (uint16_t y = 0; y < height; y++) {
+      raw[y * (row_bytes + 1)] = 0;     // filter: none
+      memcpy(&raw[y * (row_bytes + 1) + 1], &bitmap[y * row_bytes], row_bytes);
+    }
+    put32(header, width);
+    put32(header + 4, height);
+    header[8] = 1;      // bit depth
+    header[9] = 0;      // greyscale
+    header[10] = 0;     // deflate
+    header[11] = 0;     // adaptive filtering
+    header[12] = 0;     // not interlaced
+
+    FILE *f = compress2(packed, &packed_len, raw, raw_len, Z_BEST_COMPRESSION) == Z_OK ? fopen(path, "wb") : NULL;
+    if (f != NULL) {
+      ok = fwrite(SIGNATURE, 1, sizeof(SIGNATURE), f) == sizeof(SIGNATURE) &&
+           writeChunk(f, "IHDR", header, sizeof(header)) && writeChunk(f, "IDAT", packed, packed_len) &&
+           writeChunk(f, "IEND", NULL, 0);
+      ok = (fclose(f) == 0) && ok;
+    }
+  }
+  free(raw);
+  free(packed);
+  return ok;
+}
+
+/* hostReadPng()
+    Read a PNG file as written by hostWritePng(): 1 bit greyscale, not interlaced, no row filters
+  Parameters:
+    const char *path: file to read
+    uint8_t *bitmap: buffer for width x height pixels, rows padded to whole bytes, MSB first, 1 = white
+    uint16_t width, height: size the image must have
+  Returns:
+    bool: true if the file could be read and is an image of that size in that format
+*/
+bool hostReadPng(const char *path, uint8_t *bitmap, uint16_t width, uint16_t height) {
+  size_t row_bytes = (width + 7) / 8;
+  uLongf raw_len = (row_bytes + 1) * height;
+  FILE *f = fopen(path, "rb");
+  uint8_t *file = NULL, *packed = NULL, *raw = NULL;
+  long file_len = 0;
+  size_t packed_len = 0;
+  bool header_ok = false, ok = false;
+
+  if (f == NULL)
+    return false;
+  if (fseek(f, 0, SEEK_END) == 0 && (file_len = ftell(f)) > 0 && fseek(f, 0, SEEK_SET) == 0) {
+    file = (uint8_t *)malloc(file_len);
+    packed = (uint8_t *)malloc(file_len);
+    raw = (uint8_t *)malloc(raw_len);
+  }
+  if (file != NULL && packed != NULL && raw != NULL && fread(file, 1, file_len, f) == (size_t)file_len &&
+      file_len >= (long)sizeof(SIGNATURE) && memcmp(file, SIGNATURE, sizeof(SIGNATURE)) == 0) {
+    for (long pos = sizeof(SIGNATURE); pos + 12 <= file_len;) {
+      uint32_t len = get32(file + pos);
+      const uint8_t *type = file + pos + 4;
+      const uint8_t *data = file + pos + 8;
+
+      if (len > (uint32_t)(file_len - pos - 12))
+        break;
+      if (memcmp(type, "IHDR", 4) == 0)
+        header_ok = len == 13 && get32(data) == width && get32(data + 4) == height && data[8] == 1 && data[9] == 0 &&
+                    data[12] == 0;
+      else if (memcmp(type, "IDAT", 4) == 0) {
+        memcpy(packed + packed_len, data, len);
+        packed_len += len;
+      } else if (memcmp(type, "IEND", 4) == 0) {
+        ok = header_ok && uncompress(raw, &raw_len, packed, packed_len) == Z_OK &&
+             raw_len == (row_bytes + 1) * height;
+        break;
+      }
+      pos += len + 12;
+    }
+  }
+  for (uint16_t y = 0; ok && y < height; y++) {
+    ok = raw[y * (row_bytes + 1)] == 0;
+    memcpy(&bitmap[y * row_bytes], &raw[y * (row_bytes + 1) + 1], row_bytes);
+  }
+  fclose(f);
+  free(file);
+  free(packed);
+  free(raw);
+  return ok;
+}
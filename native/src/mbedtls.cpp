@@ -0,0 +1,342 @@
+/* Host implementation of the mbedTLS stand-in (native/include/mbedtls/) and of the scripted network behind it
+    (hostNet.h). Nothing is encrypted: what is written to a connection is looked at only to count the requests,
+    each complete request (up to the empty line after its headers) moves the next response queued for the host
+    into the connection, where mbedtls_ssl_read() returns it. The responses aren't copied, the data passed to
+    hostNetReply() has to stay valid. Apart from the record buffers the real library allocates (so heap figures
+    of a wake stay close to the device's) nothing here uses the heap.
+*/
+
+#include <string.h>
+#include <stdlib.h>
+#include "mbedtls/ssl.h"
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/ctr_drbg.h"
+#include "hostNet.h"
+
+  // Record buffers of the ESP32 Arduino build of mbedTLS: 16 KB in, 4 KB out, plus the record overhead of each
+const size_t SSL_BUFFER_BYTES = (16384 + 93) + (4096 + 93);
+
+const int MAX_REPLIES = 16;       // responses queued over all hosts
+const int MAX_CONNECTIONS = 4;
+const int MAX_IN_FLIGHT = 8;      // responses due on a connection, pipelined requests
+
+typedef struct Reply {
+  const char *host;
+  const uint8_t *data;
+  size_t len;
+} Reply;
+
+typedef struct Connection {
+  bool open;
+  char host[64];
+  uint32_t tail;              // last 4 bytes written, to find the end of a request
+  Reply due[MAX_IN_FLIGHT];   // responses to requests received, oldest first
+  int dueCount;
+  size_t pos;                 // bytes of due[0] read
+} Connection;
+
+static Reply replies[MAX_REPLIES];
+static int reply_count = 0;
+static Connection connections[MAX_CONNECTIONS];
+static uint32_t requests = 0;
+static uint32_t connects = 0;
+
+/* hostNetReply()
+    Queue a response for the next request to a host. Responses are given out in the order they were queued.
+  Parameters:
+    const char *host: host name as passed to HttpsSession
+    const void *response, size_t len: the raw HTTP response, not copied
+  Returns:
+    bool: false if the queue is full
+*/
+bool hostNetReply(const char *host, const void *response, size_t len) {
+  if (reply_count == MAX_REPLIES)
+    return false;
+  replies[reply_count++] = {host, (const uint8_t *)response, len};
+  return true;
+}
+
+/* hostNetReset()
+    Drop all queued responses, close all connections and reset the counters
+*/
+void hostNetReset(void) {
+  reply_count = 0;
+  memset(connections, 0, sizeof(connections));
+  requests = 0;
+  connects = 0;
+}
+
+/* hostNetRequests()
+  Returns:
+    uint32_t: requests received since the last hostNetReset()
+*/
+uint32_t hostNetRequests(void) {
+  return requests;
+}
+
+/* hostNetConnects()
+  Returns:
+    uint32_t: connections opened since the last hostNetReset()
+*/
+uint32_t hostNetConnects(void) {
+  return connects;
+}
+
+static Connection *connection(void *ctx) {
+  int fd = ((mbedtls_net_context *)ctx)->fd;
+  return (fd >= 0 && fd < MAX_CONNECTIONS && connections[fd].open) ? &connections[fd] : NULL;
+}
+
+  // A request to the connection's host has been received, answer it with the first response queued for the host
+static void answer(Connection *conn) {
+  requests++;
+  for (int i = 0; i < reply_count; i++) {
+    if (strcmp(replies[i].host, conn->host) != 0)
+      continue;
+    if (conn->dueCount < MAX_IN_FLIGHT)
+      conn->due[conn->dueCount++] = replies[i];
+    memmove(&replies[i], &replies[i + 1], (reply_count - i - 1) * sizeof(Reply));
+    reply_count--;
+    return;
+  }
+}
+
+/* Network */
+void mbedtls_net_init(mbedtls_net_context *ctx) {
+  ctx->fd = -1;
+}
+
+int mbedtls_net_connect(mbedtls_net_context *ctx, const char *host, const char *port, int proto) {
+  for (int fd = 0; fd < MAX_CONNECTIONS; fd++) {
+    if (!connections[fd].open) {
+      memset(&connections[fd], 0, sizeof(Connection));
+      connections[fd].open = true;
+      strncpy(connections[fd].host, host, sizeof(connections[fd].host) - 1);
+      ctx->fd = fd;
+      connects++;
+      return 0;
+    }
+  }
+  return MBEDTLS_ERR_NET_CONNECT_FAILED;
+}
+
+int mbedtls_net_send(void *ctx, const unsigned char *buf, size_t len) {
+  Connection *conn = connection(ctx);
+
+  if (conn == NULL)
+    return MBEDTLS_ERR_NET_CONN_RESET;
+  for (size_t i = 0; i < len; i++) {
+    conn->tail = conn->tail << 8 | buf[i];
+    if (conn->tail == 0x0d0a0d0a)     // "\r\n\r\n", the end of the headers of a GET
+      answer(conn);
+  }
+  return len;
+}
+
+  // Returns what is due without waiting, 0 (closed) when nothing is
+int mbedtls_net_recv(void *ctx, unsigned char *buf, size_t len) {
+  Connection *conn = connection(ctx);
+
+  if (conn == NULL)
+    return MBEDTLS_ERR_NET_CONN_RESET;
+  if (conn->dueCount == 0)
+    return 0;
+
+  Reply &reply = conn->due[0];
+  size_t n = reply.len - conn->pos < len ? reply.len - conn->pos : len;
+  memcpy(buf, reply.data + conn->pos, n);
+  conn->pos += n;
+  if (conn->pos == reply.len) {
+    memmove(&conn->due[0], &conn->due[1], (conn->dueCount - 1) * sizeof(Reply));
+    conn->dueCount--;
+    conn->pos = 0;
+  }
+  return n;
+}
+
+int mbedtls_net_recv_timeout(void *ctx, unsigned char *buf, size_t len, uint32_t timeout) {
+  return mbedtls_net_recv(ctx, buf, len);
+}
+
+void mbedtls_net_free(mbedtls_net_context *ctx) {
+  Connection *conn = connection(ctx);
+
+  if (conn != NULL)
+    conn->open = false;
+  ctx->fd = -1;
+}
+
+/* SSL */
+void mbedtls_ssl_init(mbedtls_ssl_context *ssl) {
+  memset(ssl, 0, sizeof(*ssl));
+}
+
+void mbedtls_ssl_free(mbedtls_ssl_context *ssl) {
+  free(ssl->buffers);
+  memset(ssl, 0, sizeof(*ssl));
+}
+
+void mbedtls_ssl_config_init(mbedtls_ssl_config *conf) {
+  memset(conf, 0, sizeof(*conf));
+}
+
+void mbedtls_ssl_config_free(mbedtls_ssl_config *conf) {
+  memset(conf, 0, sizeof(*conf));
+}
+
+int mbedtls_ssl_config_defaults(mbedtls_ssl_config *conf, int endpoint, int transport, int preset) {
+  conf->endpoint = endpoint;
+  conf->authmode = MBEDTLS_SSL_VERIFY_REQUIRED;
+  return 0;
+}
+
+void mbedtls_ssl_conf_authmode(mbedtls_ssl_config *conf, int authmode) {
+  conf->authmode = authmode;
+}
+
+void mbedtls_ssl_conf_rng(mbedtls_ssl_config *conf, int (*f_rng)(void *, unsigned char *, size_t), void *p_rng) {
+  conf->f_rng = f_rng;
+  conf->p_rng = p_rng;
+}
+
+void mbedtls_ssl_conf_read_timeout(mbedtls_ssl_config *conf, uint32_t timeout) {
+  conf->read_timeout = timeout;
+}
+
+int mbedtls_ssl_setup(mbedtls_ssl_context *ssl, const mbedtls_ssl_config *conf) {
+  ssl->conf = conf;
+  ssl->buffers = (unsigned char *)malloc(SSL_BUFFER_BYTES);
+  return ssl->buffers != NULL ? 0 : MBEDTLS_ERR_SSL_ALLOC_FAILED;
+}
+
+int mbedtls_ssl_set_hostname(mbedtls_ssl_context *ssl, const char *hostname) {
+  if (strlen(hostname) >= sizeof(ssl->hostname))
+    return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+  strcpy(ssl->hostname, hostname);
+  return 0;
+}
+
+void mbedtls_ssl_set_bio(mbedtls_ssl_context *ssl, void *p_bio, mbedtls_ssl_send_t *f_send, mbedtls_ssl_recv_t *f_recv,
+                         mbedtls_ssl_recv_timeout_t *f_recv_timeout) {
+  ssl->p_bio = p_bio;
+}
+
+/* mbedtls_ssl_handshake_step()
+    Go to the next state of a client handshake. The server resumes the session offered if it was established with
+    the same host, otherwise it sends its certificate and a full handshake follows.
+  Returns:
+    int: 0, MBEDTLS_ERR_SSL_BAD_INPUT_DATA if the connection isn't open
+*/
+int mbedtls_ssl_handshake_step(mbedtls_ssl_context *ssl) {
+  if (ssl->p_bio == NULL || connection(ssl->p_bio) == NULL)
+    return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+
+  switch (ssl->state) {
+  case MBEDTLS_SSL_HELLO_REQUEST:
+    ssl->state = MBEDTLS_SSL_CLIENT_HELLO;
+    break;
+  case MBEDTLS_SSL_CLIENT_HELLO:
+    ssl->state = MBEDTLS_SSL_SERVER_HELLO;
+    break;
+  case MBEDTLS_SSL_SERVER_HELLO:
+    ssl->resumed = strcmp(ssl->session.host, ssl->hostname) == 0;
+    ssl->state = ssl->resumed ? MBEDTLS_SSL_HANDSHAKE_OVER : MBEDTLS_SSL_SERVER_CERTIFICATE;
+    break;
+  default:      // the rest of a full handshake
+    strcpy(ssl->session.host, ssl->hostname);
+    ssl->state = MBEDTLS_SSL_HANDSHAKE_OVER;
+    break;
+  }
+  return 0;
+}
+
+int mbedtls_ssl_read(mbedtls_ssl_context *ssl, unsigned char *buf, size_t len) {
+  if (ssl->state != MBEDTLS_SSL_HANDSHAKE_OVER)
+    return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+  return mbedtls_net_recv(ssl->p_bio, buf, len);
+}
+
+int mbedtls_ssl_write(mbedtls_ssl_context *ssl, const unsigned char *buf, size_t len) {
+  if (ssl->state != MBEDTLS_SSL_HANDSHAKE_OVER)
+    return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+  return mbedtls_net_send(ssl->p_bio, buf, len);
+}
+
+int mbedtls_ssl_close_notify(mbedtls_ssl_context *ssl) {
+  return 0;
+}
+
+/* Sessions, saved as the name of the host they belong to */
+void mbedtls_ssl_session_init(mbedtls_ssl_session *session) {
+  memset(session, 0, sizeof(*session));
+}
+
+void mbedtls_ssl_session_free(mbedtls_ssl_session *session) {
+  memset(session, 0, sizeof(*session));
+}
+
+int mbedtls_ssl_set_session(mbedtls_ssl_context *ssl, const mbedtls_ssl_session *session) {
+  ssl->session = *session;
+  return 0;
+}
+
+int mbedtls_ssl_get_session(const mbedtls_ssl_context *ssl, mbedtls_ssl_session *session) {
+  if (ssl->state != MBEDTLS_SSL_HANDSHAKE_OVER)
+    return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+  *session = ssl->session;
+  return 0;
+}
+
+int mbedtls_ssl_session_save(const mbedtls_ssl_session *session, unsigned char *buf, size_t buf_len, size_t *olen) {
+  *olen = strlen(session->host) + 1;
+  if (*olen > buf_len)
+    return MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL;
+  memcpy(buf, session->host, *olen);
+  return 0;
+}
+
+int mbedtls_ssl_session_load(mbedtls_ssl_session *session, const unsigned char *buf, size_t len) {
+  if (len == 0 || len > sizeof(session->host) || buf[len - 1] != '\0')
+    return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+  memcpy(session->host, buf, len);
+  return 0;
+}
+
+/* Entropy and random numbers, not needed for a loopback */
+void mbedtls_entropy_init(mbedtls_entropy_context *ctx) {
+  ctx->initialised = 1;
+}
+
+void mbedtls_entropy_free(mbedtls_entropy_context *ctx) {
+  ctx->initialised = 0;
+}
+
+int mbedtls_entropy_func(void *data, unsigned char *output, size_t len) {
+  for (size_t i = 0; i < len; i++)
+    output[i] = rand();
+  return 0;
+}
+
+void mbedtls_ctr_drbg_init(mbedtls_ctr_drbg_context *ctx) {
+  ctx->state = 0;
+}
+
+void mbedtls_ctr_drbg_free(mbedtls_ctr_drbg_context *ctx) {
+  ctx->state = 0;
+}
+
+int mbedtls_ctr_drbg_seed(mbedtls_ctr_drbg_context *ctx, int (*f_entropy)(void *, unsigned char *, size_t),
+                          void *p_entropy, const unsigned char *custom, size_t len) {
+  return f_entropy(p_entropy, (unsigned char *)&ctx->state, sizeof(ctx->state));
+}
+
+int mbedtls_ctr_drbg_random(void *p_rng, unsigned char *output, size_t output_len) {
+  mbedtls_ctr_drbg_context *ctx = (mbedtls_ctr_drbg_context *)p_rng;
+
+  for (size_t i = 0; i < output_len; i++) {
+    ctx->state = ctx->state * 1103515245 + 12345;
+    output[i] = ctx->state >> 16;
+  }
+  return 0;
+}
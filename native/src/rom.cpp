@@ -0,0 +1,19 @@
+/* Host implementation of the ESP32 ROM functions the firmware uses (native/include/rom/)
+*/
+
+#include "rom/crc.h"
+
+/* crc32_le()
+    crc32 (IEEE 802.3, reflected), continued from crc like the ROM version: crc32_le(0, ...) starts a new one
+  Returns:
+    uint32_t: crc32 of the data so far
+*/
+uint32_t crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len) {
+  crc = ~crc;
+  while (len-- > 0) {
+    crc ^= *buf++;
+    for (int bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
@@ -0,0 +1,275 @@
+/* The GzipStream library (consisting of gzipStream.h and gzipStream.cpp) inflates a gzip encoded stream (e.g. the
+    body of an HttpsSession response sent with Content-Encoding: gzip) as it is read, so it can be handed straight
+    to deserializeJson() like the stream it wraps. It uses the inflater in the ESP32 ROM. The 32 KB window and the
+    inflater state are allocated by reserve() or the first begin() and reused by every stream inflated after that.
+*/
+
+#include <Arduino.h>
+#include <rom/crc.h>
+#include "gzipStream.h"
+
+  // gzip header flags (RFC 1952)
+const uint8_t GZIP_FHCRC = 0x02;
+const uint8_t GZIP_FEXTRA = 0x04;
+const uint8_t GZIP_FNAME = 0x08;
+const uint8_t GZIP_FCOMMENT = 0x10;
+
+/* GzipStream::GzipStream()
+    Class object constructor, nothing is allocated until reserve() or begin() is called
+  Parameters: None
+  Returns: None
+*/
+GzipStream::GzipStream() {
+  in = NULL;
+  buffers = NULL;
+  inflated = 0;
+  inPos = 0;
+  inLen = 0;
+  inputDone = true;
+  outPos = 0;
+  outEnd = 0;
+  windowPos = 0;
+  status = TINFL_STATUS_DONE;
+  failed = false;
+  crc = 0;
+}
+
+/* GzipStream::~GzipStream()
+    Class object destructor, releases the window
+*/
+GzipStream::~GzipStream() {
+  free(buffers);
+}
+
+/* GzipStream::reserve()
+    Allocate the window and inflater state now, so a caller can find out whether there is room for them before it
+    asks for gzip encoded data.
+  Parameters: None
+  Returns:
+    bool: true if the window is allocated
+*/
+bool GzipStream::reserve() {
+  if (buffers == NULL)
+    buffers = (Buffers *)malloc(sizeof(Buffers));
+  return buffers != NULL;
+}
+
+/* GzipStream::begin()
+    Start inflating a gzip stream: read its header, the inflated data can then be read through the Stream
+    interface. The window is allocated the first time, unless reserve() already did.
+  Parameters:
+    Stream *in: gzip encoded stream, positioned at the start of the gzip header
+  Returns:
+    bool: true if the header is valid (and the window could be allocated)
+*/
+bool GzipStream::begin(Stream *in) {
+  if (!reserve())
+    return false;
+
+  this->in = in;
+  inflated = 0;
+  inPos = 0;
+  inLen = 0;
+  inputDone = false;
+  outPos = 0;
+  outEnd = 0;
+  windowPos = 0;
+  failed = false;
+  crc = 0;
+  tinfl_init(&buffers->inflator);
+  status = TINFL_STATUS_NEEDS_MORE_INPUT;
+
+  if (!readHeader()) {
+    failed = true;
+    status = TINFL_STATUS_FAILED;
+    return false;
+  }
+  return true;
+}
+
+/* GzipStream::finish()
+    Inflate the rest of the stream, if the reader stopped before its end (deserializeJson() stops after the
+    JSON value), and check the gzip trailer.
+  Parameters: None
+  Returns:
+    bool: true if the whole stream was valid and the crc and size in its trailer match the inflated data
+*/
+bool GzipStream::finish() {
+  if (in == NULL)
+    return false;
+  while (read() >= 0)
+    ;
+  in = NULL;
+  return !failed && status == TINFL_STATUS_DONE;
+}
+
+/* GzipStream::available()
+  Returns:
+    int: number of inflated bytes that can be read without inflating more (at least 1 while the stream isn't done)
+*/
+int GzipStream::available() {
+  if (outEnd > outPos)
+    return outEnd - outPos;
+  return (in != NULL && !failed && status != TINFL_STATUS_DONE) ? 1 : 0;
+}
+
+/* GzipStream::read()
+    Read the next inflated byte, inflating more of the stream when all inflated bytes have been read.
+  Parameters: None
+  Returns:
+    int: the byte read, or -1 at the end of the stream or if it isn't valid gzip
+*/
+int GzipStream::read() {
+  int c = peek();
+
+  if (c >= 0)
+    outPos++;
+  return c;
+}
+
+/* GzipStream::peek()
+  Returns:
+    int: the next inflated byte without consuming it, or -1 at the end of the stream
+*/
+int GzipStream::peek() {
+  if (outPos == outEnd && !inflateMore())
+    return -1;
+  return buffers->window[outPos];
+}
+
+/* GzipStream::fillInput()
+    Refill the input buffer from the wrapped stream once all of it has been consumed.
+  Returns:
+    bool: true if there are compressed bytes in the buffer
+*/
+bool GzipStream::fillInput() {
+  if (inPos < inLen)
+    return true;
+  inPos = 0;
+  inLen = 0;
+  while (!inputDone && inLen < INPUT_SIZE) {
+    int c = in->read();
+    if (c < 0)
+      inputDone = true;
+    else
+      input[inLen++] = c;
+  }
+  return inLen > 0;
+}
+
+/* GzipStream::inputByte()
+  Returns:
+    int: the next compressed byte, -1 when the wrapped stream has ended
+*/
+int GzipStream::inputByte() {
+  if (!fillInput())
+    return -1;
+  return input[inPos++];
+}
+
+/* GzipStream::readHeader()
+    Read the gzip header (RFC 1952) up to the start of the deflate data.
+  Returns:
+    bool: true if it is a gzip header of deflate data
+*/
+bool GzipStream::readHeader() {
+  uint8_t header[10];
+  int c;
+
+  for (uint8_t i = 0; i < sizeof(header); i++) {
+    if ((c = inputByte()) < 0)
+      return false;
+    header[i] = c;
+  }
+  if (header[0] != 0x1f || header[1] != 0x8b || header[2] != 8)   // magic, method deflate
+    return false;
+
+  uint8_t flags = header[3];
+  if (flags & GZIP_FEXTRA) {
+    int lo = inputByte();
+    int hi = inputByte();
+    if (hi < 0)
+      return false;
+    for (uint16_t len = lo | (hi << 8); len > 0; len--) {
+      if (inputByte() < 0)
+        return false;
+    }
+  }
+  if (flags & GZIP_FNAME) {
+    while ((c = inputByte()) > 0)
+      ;
+    if (c < 0)
+      return false;
+  }
+  if (flags & GZIP_FCOMMENT) {
+    while ((c = inputByte()) > 0)
+      ;
+    if (c < 0)
+      return false;
+  }
+  if (flags & GZIP_FHCRC) {
+    inputByte();
+    if (inputByte() < 0)
+      return false;
+  }
+  return true;
+}
+
+/* GzipStream::inflateMore()
+    Inflate the next part of the stream into the window, after all of the previous part has been read. At the end
+    of the deflate data the trailer is checked.
+  Returns:
+    bool: true if more inflated bytes are available
+*/
+bool GzipStream::inflateMore() {
+  if (in == NULL || failed || status == TINFL_STATUS_DONE)
+    return false;
+
+  for (;;) {
+    fillInput();
+    size_t inBytes = inLen - inPos;
+    size_t outBytes = TINFL_LZ_DICT_SIZE - windowPos;
+
+    status = tinfl_decompress(&buffers->inflator, input + inPos, &inBytes, buffers->window, buffers->window + windowPos,
+                              &outBytes, inputDone ? 0 : TINFL_FLAG_HAS_MORE_INPUT);
+    inPos += inBytes;
+    crc = crc32_le(crc, buffers->window + windowPos, outBytes);
+    inflated += outBytes;
+    outPos = windowPos;
+    outEnd = windowPos + outBytes;
+    windowPos = (windowPos + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+
+    if (status == TINFL_STATUS_DONE && !checkTrailer())
+      failed = true;
+    if (status < TINFL_STATUS_DONE || (status == TINFL_STATUS_NEEDS_MORE_INPUT && inputDone))
+      failed = true;
+    if (failed) {
+      outEnd = outPos;    // don't hand out data of a broken stream
+      return false;
+    }
+    if (outBytes > 0)
+      return true;
+    if (status == TINFL_STATUS_DONE)
+      return false;
+  }
+}
+
+/* GzipStream::checkTrailer()
+    Read the gzip trailer after the deflate data and compare it with what was inflated. The inflater may have
+    loaded the first bytes of the trailer into its bit buffer already (older miniz versions, like the one in
+    ROM, don't give them back), those are taken from there.
+  Returns:
+    bool: true if the crc32 and size (modulo 2^32) match
+*/
+bool GzipStream::checkTrailer() {
+  uint32_t trailer[2] = {0, 0};     // crc32, size
+  uint8_t buffered = buffers->inflator.m_num_bits / 8;
+
+  for (uint8_t i = 0; i < 8; i++) {
+    int c = (i < buffered) ? (int)((buffers->inflator.m_bit_buf >> (8 * i)) & 0xff) : inputByte();
+    if (c < 0)
+      return false;
+    trailer[i / 4] |= (uint32_t)c << (8 * (i % 4));
+  }
+  return trailer[0] == crc && trailer[1] == inflated;
+}
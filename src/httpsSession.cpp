@@ -0,0 +1,532 @@
+/* The HttpsSession library (consisting of httpsSession.h and httpsSession.cpp) implements a small HTTP/1.1 client
+    on top of mbedTLS that keeps the connection to a host open between requests. Requests can be pipelined
+    (several sent before the first response is read), responses with a Content-Length or a chunked body are
+    supported and the body of the current response is read through the Stream interface, so it can be handed
+    straight to deserializeJson(). The TLS session can be saved in a TlsSessionCache (e.g. in RTC memory) so
+    the next connection to the host resumes it instead of doing a full handshake.
+*/
+
+#include <Arduino.h>
+#include <rom/crc.h>
+#include "httpsSession.h"
+
+  // The handshake state is private in mbedTLS 3.x (Arduino-ESP32 3.x), which defines MBEDTLS_VERSION_MAJOR in the
+  // build_info.h its ssl.h includes, 2.x doesn't without version.h
+#if defined(MBEDTLS_VERSION_MAJOR) && MBEDTLS_VERSION_MAJOR >= 3
+#define SSL_STATE(ssl) ((ssl).MBEDTLS_PRIVATE(state))
+#else
+#define SSL_STATE(ssl) ((ssl).state)
+#endif
+
+/* parseHttpDate()
+    Convert the value of a Date header (RFC 7231 IMF-fixdate, e.g. "Tue, 15 Nov 1994 08:12:31 GMT") to unix time.
+  Parameters:
+    const char *value: header value
+  Returns:
+    time_t: unix time, 0 if the value couldn't be parsed
+*/
+static time_t parseHttpDate(const char *value) {
+  static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+  char month[4];
+  int day, year, hour, minute, second;
+
+  if (sscanf(value, "%*3s, %d %3s %d %d:%d:%d", &day, month, &year, &hour, &minute, &second) != 6)
+    return 0;
+  const char *found = strstr(months, month);
+  if (found == NULL || (found - months) % 3 != 0 || year < 1970)
+    return 0;
+
+  int mon = (found - months) / 3;         // 0 = January
+  int y = year - (mon < 2);               // days counted from March 1st, so leap days come last
+  int doy = (153 * ((mon + 10) % 12) + 2) / 5 + day - 1;
+  long days = 365L * y + y / 4 - y / 100 + y / 400 + doy - 719468;   // 719468 = days from 0000-03-01 to 1970-01-01
+  return (time_t)days * 86400 + hour * 3600 + minute * 60 + second;
+}
+
+/* HttpsSession::HttpsSession()
+    Class object constructor, no connection is made until the first request is sent
+  Parameters:
+    const char *host: host name, must stay valid for the life of the session
+    TlsSessionCache *session: saved TLS session to resume, updated after each handshake (NULL = don't save)
+    uint16_t port: port to connect to
+  Returns: None
+*/
+HttpsSession::HttpsSession(const char *host, TlsSessionCache *session, uint16_t port) {
+  this->host = host;
+  this->session = session;
+  this->port = port;
+  open = false;
+  rxPos = 0;
+  rxLen = 0;
+  status = 0;
+  date = 0;
+  received = 0;
+  memset(&validator, 0, sizeof(validator));
+  gzipped = false;
+  gzipAccepted = false;
+  numPending = 0;
+  keepAlive = false;
+  chunked = false;
+  bodyDone = true;
+  remaining = 0;
+  peeked = -1;
+}
+
+/* HttpsSession::~HttpsSession()
+    Class object destructor, closes the connection and releases the TLS contexts
+*/
+HttpsSession::~HttpsSession() {
+  close();
+}
+
+/* HttpsSession::send()
+    Send a GET request without waiting for the response, so several requests can be pipelined. The
+    responses are then read in the same order with response().
+  Parameters:
+    const char *path: request path (or full URL), must stay valid until its response has been read
+    const HttpValidator *conditional: validators of the response we already have, the server answers 304 if
+      it hasn't changed (NULL = unconditional), must stay valid until the response has been read
+  Returns:
+    bool: true if the request was sent
+*/
+bool HttpsSession::send(const char *path, const HttpValidator *conditional) {
+  if (numPending == MAX_PENDING)
+    return false;
+  if (!open) {
+    if (numPending > 0)       // connection lost with requests in flight, response() will resend them
+      return false;
+    if (!connect())
+      return false;
+  }
+  if (!writeRequest(path, conditional))
+    return false;
+  pending[numPending] = path;
+  conditions[numPending++] = conditional;
+  return true;
+}
+
+/* HttpsSession::response()
+    Read the status line and headers of the response to the oldest pending request. Any unread body of the
+    previous response is skipped first. If the server closed the connection before this response started
+    (e.g. it doesn't keep pipelined requests), the session reconnects and sends the pending requests again.
+  Parameters: None
+  Returns:
+    bool: true if a response was received, the status code is in status and the body can be read
+*/
+bool HttpsSession::response() {
+  char line[128];
+
+  finish();
+  status = 0;
+  date = 0;
+  memset(&validator, 0, sizeof(validator));
+  gzipped = false;
+  if (numPending == 0)
+    return false;
+
+  for (uint8_t attempt = 0; ; attempt++) {
+    if (!open) {
+      if (!connect())
+        return false;
+      for (uint8_t i = 0; i < numPending; i++) {
+        if (!writeRequest(pending[i], conditions[i]))
+          return false;
+      }
+    }
+    if (readLine(line, sizeof(line)))
+      break;
+    close();              // nothing received, try once more on a new connection
+    if (attempt > 0)
+      return false;
+  }
+  if (strncmp(line, "HTTP/1.", 7) != 0) {
+    close();
+    return false;
+  }
+  status = atoi(line + 9);    // "HTTP/1.1 200 OK"
+  numPending--;
+  memmove(pending, pending + 1, numPending * sizeof(pending[0]));
+  memmove(conditions, conditions + 1, numPending * sizeof(conditions[0]));
+
+  keepAlive = (line[7] == '1');   // HTTP/1.1 defaults to keep-alive, HTTP/1.0 doesn't
+  chunked = false;
+  remaining = -1;
+  while (readLine(line, sizeof(line)) && line[0] != '\0') {
+    char *value = strchr(line, ':');
+    if (value == NULL)
+      continue;
+    *value++ = '\0';
+    while (*value == ' ')
+      value++;
+    if (strcasecmp(line, "Content-Length") == 0)
+      remaining = atol(value);
+    else if (strcasecmp(line, "Transfer-Encoding") == 0 && strcasecmp(value, "chunked") == 0)
+      chunked = true;
+    else if (strcasecmp(line, "Content-Encoding") == 0)
+      gzipped = (strcasecmp(value, "gzip") == 0);
+    else if (strcasecmp(line, "Connection") == 0)
+      keepAlive = (strcasecmp(value, "close") != 0);
+    else if (strcasecmp(line, "Date") == 0)
+      date = parseHttpDate(value);
+    else if (strcasecmp(line, "ETag") == 0 && strlen(value) < sizeof(validator.etag))
+      strcpy(validator.etag, value);
+    else if (strcasecmp(line, "Last-Modified") == 0 && strlen(value) < sizeof(validator.lastModified))
+      strcpy(validator.lastModified, value);
+  }
+  if (status == 204 || status == 304 || status / 100 == 1) {
+    chunked = false;      // these never have a body, whatever the headers say
+    remaining = 0;
+  }
+
+  peeked = -1;
+  bodyDone = false;
+  if (chunked) {
+    remaining = 0;
+    nextChunk();
+  } else if (remaining == 0) {
+    bodyDone = true;
+  } else if (remaining < 0) {
+    keepAlive = false;    // body ends when the server closes the connection
+  }
+  return true;
+}
+
+/* HttpsSession::get()
+    Send a GET request and read the response headers.
+  Parameters:
+    const char *path: request path (or full URL)
+  Returns:
+    bool: true if a response was received
+*/
+bool HttpsSession::get(const char *path) {
+  return (send(path) && response());
+}
+
+/* HttpsSession::acceptGzip()
+    Let the server send the bodies of the following requests gzip encoded (Accept-Encoding: gzip). Whether a body
+    actually is, is in gzipped after response().
+  Parameters:
+    bool accept: true = ask for gzip, false = plain bodies only
+  Returns: None
+*/
+void HttpsSession::acceptGzip(bool accept) {
+  gzipAccepted = accept;
+}
+
+/* HttpsSession::finish()
+    Skip the rest of the current response body so the connection can be used for the next response. The
+    connection is closed if the server doesn't keep it open.
+  Parameters: None
+  Returns: None
+*/
+void HttpsSession::finish() {
+  if (!bodyDone) {
+    while (read() >= 0)
+      ;
+  }
+  if (!keepAlive && numPending == 0)
+    close();
+}
+
+/* HttpsSession::stop()
+    Close the connection and forget any pending requests.
+  Parameters: None
+  Returns: None
+*/
+void HttpsSession::stop() {
+  close();
+  numPending = 0;
+  bodyDone = true;
+  peeked = -1;
+}
+
+/* HttpsSession::available()
+  Returns:
+    int: number of body bytes that can be read without waiting (at least 1 while the body isn't done)
+*/
+int HttpsSession::available() {
+  if (bodyDone)
+    return 0;
+  int n = rxLen - rxPos;
+  if (remaining > 0 && n > remaining)
+    n = remaining;
+  return (n > 0 ? n : 1);
+}
+
+/* HttpsSession::read()
+    Read the next byte of the current response body, waiting up to TIMEOUT ms for it to arrive. The byte is
+    added to validator.bodyCrc.
+  Parameters: None
+  Returns:
+    int: the byte read, or -1 at the end of the body or on a timeout
+*/
+int HttpsSession::read() {
+  int c;
+
+  if (peeked >= 0) {
+    c = peeked;
+    peeked = -1;
+    return c;
+  }
+  if (bodyDone)
+    return -1;
+
+  c = clientRead();
+  if (c < 0) {            // timeout or connection closed, the body ends here
+    bodyDone = true;
+    keepAlive = false;
+    return -1;
+  }
+  if (remaining > 0 && --remaining == 0) {
+    if (chunked)
+      nextChunk();
+    else
+      bodyDone = true;
+  }
+  uint8_t byte = c;
+  validator.bodyCrc = crc32_le(validator.bodyCrc, &byte, 1);
+  return c;
+}
+
+/* HttpsSession::peek()
+  Returns:
+    int: the next byte of the body without consuming it, or -1 at the end of the body
+*/
+int HttpsSession::peek() {
+  if (peeked < 0)
+    peeked = read();
+  return peeked;
+}
+
+/* HttpsSession::connect()
+    Open the connection to the host. A saved TLS session is offered to the server first, if that handshake
+    fails the saved session is dropped and a full handshake is done instead.
+  Returns:
+    bool: true if connected
+*/
+bool HttpsSession::connect() {
+  bool resume = (session != NULL && session->len > 0);
+
+  if (handshake(resume))
+    return true;
+  if (!resume)
+    return false;
+  session->len = 0;       // server didn't accept the saved session
+  return handshake(false);
+}
+
+/* HttpsSession::handshake()
+    Set up the TLS contexts, connect to the host and do the TLS handshake. The certificate is not checked.
+    After a successful handshake the (possibly new) session is saved for the next connection, if it fits.
+  Parameters:
+    bool resume: offer the saved session to the server
+  Returns:
+    bool: true if connected
+*/
+bool HttpsSession::handshake(bool resume) {
+  char portStr[6];
+  bool full = false;    // the server sent its certificate, so the saved session wasn't resumed
+  int ret;
+
+  close();
+  mbedtls_net_init(&net);
+  mbedtls_ssl_init(&ssl);
+  mbedtls_ssl_config_init(&conf);
+  mbedtls_entropy_init(&entropy);
+  mbedtls_ctr_drbg_init(&drbg);
+  open = true;
+  rxPos = 0;
+  rxLen = 0;
+
+  snprintf(portStr, sizeof(portStr), "%u", port);
+  if (mbedtls_ctr_drbg_seed(&drbg, mbedtls_entropy_func, &entropy, NULL, 0) != 0 ||
+      mbedtls_net_connect(&net, host, portStr, MBEDTLS_NET_PROTO_TCP) != 0 ||
+      mbedtls_ssl_config_defaults(&conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT) != 0)
+    goto failed;
+  mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_NONE);
+  mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &drbg);
+  mbedtls_ssl_conf_read_timeout(&conf, TIMEOUT);
+  if (mbedtls_ssl_setup(&ssl, &conf) != 0 || mbedtls_ssl_set_hostname(&ssl, host) != 0)
+    goto failed;
+  mbedtls_ssl_set_bio(&ssl, &net, mbedtls_net_send, NULL, mbedtls_net_recv_timeout);
+
+  if (resume) {
+    mbedtls_ssl_session saved;
+    mbedtls_ssl_session_init(&saved);
+    ret = mbedtls_ssl_session_load(&saved, session->data, session->len);
+    if (ret == 0)
+      ret = mbedtls_ssl_set_session(&ssl, &saved);
+    mbedtls_ssl_session_free(&saved);
+    if (ret != 0)
+      goto failed;
+  }
+
+  // Step through the handshake to see which way the server took after its ServerHello
+  while (SSL_STATE(ssl) != MBEDTLS_SSL_HANDSHAKE_OVER) {
+    ret = mbedtls_ssl_handshake_step(&ssl);
+    if (ret != 0 && ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE)
+      goto failed;
+    if (SSL_STATE(ssl) == MBEDTLS_SSL_SERVER_CERTIFICATE)
+      full = true;
+  }
+
+  if (session != NULL) {
+    mbedtls_ssl_session current;
+    size_t len = 0;
+
+    if (full || !resume)
+      session->full++;
+    else
+      session->resumed++;
+
+    session->len = 0;
+    session->needed = 0;
+    mbedtls_ssl_session_init(&current);
+    if (mbedtls_ssl_get_session(&ssl, &current) == 0) {
+      ret = mbedtls_ssl_session_save(&current, session->data, sizeof(session->data), &len);
+      if (ret == 0)
+        session->len = len;
+      else if (ret == MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL)
+        session->needed = len;    // len is the room it wanted, the next connection does a full handshake
+    }
+    mbedtls_ssl_session_free(&current);
+  }
+  return true;
+
+failed:
+  close();
+  return false;
+}
+
+/* HttpsSession::close()
+    Close the connection (if open) and release the TLS contexts.
+  Returns: None
+*/
+void HttpsSession::close() {
+  if (!open)
+    return;
+  mbedtls_ssl_close_notify(&ssl);
+  mbedtls_net_free(&net);
+  mbedtls_ssl_free(&ssl);
+  mbedtls_ssl_config_free(&conf);
+  mbedtls_ctr_drbg_free(&drbg);
+  mbedtls_entropy_free(&entropy);
+  open = false;
+  rxPos = 0;
+  rxLen = 0;
+}
+
+/* HttpsSession::writeRequest()
+    Write the request line and headers of a GET request.
+  Parameters:
+    const char *path: request path (or full URL)
+    const HttpValidator *conditional: adds If-None-Match/If-Modified-Since for the validators it has, NULL = none
+  Returns:
+    bool: true if the request was written completely
+*/
+bool HttpsSession::writeRequest(const char *path, const HttpValidator *conditional) {
+  char request[384];
+  int len = snprintf(request, sizeof(request), "GET %s HTTP/1.1\r\nHost: %s\r\nConnection: keep-alive\r\n", path, host);
+  int sent = 0;
+
+  if (conditional != NULL && conditional->etag[0] != '\0' && len >= 0 && len < (int)sizeof(request))
+    len += snprintf(request + len, sizeof(request) - len, "If-None-Match: %s\r\n", conditional->etag);
+  if (conditional != NULL && conditional->lastModified[0] != '\0' && len >= 0 && len < (int)sizeof(request))
+    len += snprintf(request + len, sizeof(request) - len, "If-Modified-Since: %s\r\n", conditional->lastModified);
+  if (gzipAccepted && len >= 0 && len < (int)sizeof(request))
+    len += snprintf(request + len, sizeof(request) - len, "Accept-Encoding: gzip\r\n");
+  if (len >= 0 && len < (int)sizeof(request))
+    len += snprintf(request + len, sizeof(request) - len, "\r\n");
+
+  if (!open || len < 0 || len >= (int)sizeof(request))
+    return false;
+  while (sent < len) {
+    int ret = mbedtls_ssl_write(&ssl, (const unsigned char *)request + sent, len - sent);
+    if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE)
+      continue;
+    if (ret <= 0) {
+      close();
+      return false;
+    }
+    sent += ret;
+  }
+  return true;
+}
+
+/* HttpsSession::clientRead()
+    Read a byte from the connection, waiting up to TIMEOUT ms for more data to arrive.
+  Returns:
+    int: the byte read, -1 on a timeout or when the connection has closed
+*/
+int HttpsSession::clientRead() {
+  while (rxPos == rxLen) {
+    if (!open)
+      return -1;
+    int ret = mbedtls_ssl_read(&ssl, rx, sizeof(rx));
+    if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE)
+      continue;
+    if (ret <= 0) {       // timeout, error or the server closed the connection
+      close();
+      return -1;
+    }
+    rxPos = 0;
+    rxLen = ret;
+    received += ret;
+  }
+  return rx[rxPos++];
+}
+
+/* HttpsSession::readLine()
+    Read a header line, without the line ending. Characters that don't fit are dropped.
+  Parameters:
+    char *line: buffer for the line
+    size_t size: size of the buffer
+  Returns:
+    bool: true if a complete line was read
+*/
+bool HttpsSession::readLine(char *line, size_t size) {
+  size_t len = 0;
+  int c;
+
+  while ((c = clientRead()) >= 0) {
+    if (c == '\n') {
+      if (len > 0 && line[len - 1] == '\r')
+        len--;
+      line[len] = '\0';
+      return true;
+    }
+    if (len < size - 1)
+      line[len++] = c;
+  }
+  line[len] = '\0';
+  return false;
+}
+
+/* HttpsSession::nextChunk()
+    Read the size line of the next chunk of a chunked body. A chunk of size 0 ends the body, the trailer
+    lines after it are skipped.
+  Returns:
+    bool: true if there is another chunk to read
+*/
+bool HttpsSession::nextChunk() {
+  char line[32];
+
+  if (!readLine(line, sizeof(line)))      // the line ending after the previous chunk's data
+    goto failed;
+  if (line[0] == '\0' && !readLine(line, sizeof(line)))
+    goto failed;
+
+  remaining = strtol(line, NULL, 16);     // chunk extensions after ';' are ignored by strtol
+  if (remaining > 0)
+    return true;
+
+  while (readLine(line, sizeof(line)) && line[0] != '\0')   // trailer
+    ;
+  bodyDone = true;
+  return false;
+
+failed:
+  bodyDone = true;
+  keepAlive = false;
+  return false;
+}
@@ -33,6 +33,10 @@
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 #include "esp_adc_cal.h"    // So we can read the battery voltage
+#include <type_traits>
+#include <rom/crc.h>        // crc32_le() for the RTC cache
+#include "freertos/event_groups.h"
+#include "esp_sntp.h"
 
 #include "GxEPD2_GFX.h"
 #include "GxEPD2_BW.h"
@@ -42,13 +46,19 @@
 
 #include <Fonts/FreeMonoBold12pt7b.h>
 #include <Fonts/FreeMonoBold9pt7b.h>
+#ifdef CONFIG_FILE
+#include CONFIG_FILE   // e.g. config_example.h for the host build ([env:native]), which has no config.h
+#else
 #include "config.h"
+#endif
 #include "fonts.h"
 #include "arrow.h"
 #include "sunrise.h"
 #include "sunset.h"
 #include "OpenSans_Regular24pt7b.h"
 #include "OpenSans_Regular18pt7b.h"
+#include "fixedTrig.h"
+#include "weatherData.h"
 
 // turn red into black, if no red available:
 #if defined(_GxEPD2_BW_H_)
@@ -58,6 +68,28 @@
 // CaptureLog setup
 #define CLOG_ENABLE false                        // this must be defined before cLog.h is included 
 #include "cLog.h"
+#include "httpsSession.h"
+#include "gzipStream.h"
+#include "textCanvas.h"
+#include "wakeSchedule.h"
+
+// Render profiling, normally set from platformio.ini ([env:native])
+#ifndef RENDER_FIXTURE
+#define RENDER_FIXTURE false    // render the fixture data instead of fetching it, no wifi needed
+#endif
+#ifndef RENDER_STATS
+#define RENDER_STATS RENDER_FIXTURE // count draw primitives and time the render
+#endif
+#ifndef ICON_ATLAS_GENERATE
+#define ICON_ATLAS_GENERATE false   // rasterize the weather icons and print them as include/iconAtlas.h (host build [env:icon-atlas])
+#endif
+
+#if RENDER_STATS
+#include "countingCanvas.h"
+#endif
+#if RENDER_FIXTURE
+#include "renderFixture.h"
+#endif
 
 #if CLOG_ENABLE
 const uint16_t maxEntries = 20;
@@ -72,17 +104,33 @@ CLOG_NEW myLog1(maxEntries, maxEntryChars, NO_TRIGGER, NO_WRAP);
 // Battery voltage pin
 #define BAT_ADC 2
 const float LOW_BATTERY_VOLTAGE = 3.40; // warn user battery low!
+const float BATTERY_NOISE_MV = 20;      // readings closer than this to the last one are treated as unchanged
+RTC_DATA_ATTR float last_battery_voltage = 0;
 
 /* Constants/defines */
 const uint SCREEN_WIDTH = 400;
 const uint SCREEN_HEIGHT = 300;
 const String VERSION = "v3.1";
 const String Hemisphere = "north";
-const int forecast_counter = 16; // Number of forecasts to get/show.
+// Timezone - London: "GMT0BST,M3.5.0/1,M10.5.0", Germany for us:
+const char TIMEZONE[] = "CET-1CEST,M3.5.0,M10.5.0/3";
+#define FORECAST_API_COUNT 24    // Forecasts returned by the API, must match 'cnt=' in FORECAST_URL
+static_assert(forecast_counter <= FORECAST_API_COUNT, "FORECAST_URL must request at least forecast_counter entries");
 
 const long sleep_duration = 30; // Number of minutes to go to sleep for
 const int sleep_hour = 23;      // Start power saving at 23:00
-const int wakeup_hour = 6;      // Stop power saving at 08:00
+const int wakeup_hour = 6;      // Stop power saving at 06:00
+
+/*
+ * Wake policy over the day, sorted by start hour. Each entry runs until the next one starts,
+ * the last one wraps past midnight into the first.
+ */
+const SleepPolicy sleep_policies[] = {
+    {0, 120},                       // power saving
+    {wakeup_hour, sleep_duration},
+    {sleep_hour, 120}               // power saving
+};
+const int SLEEP_POLICY_COUNT = sizeof(sleep_policies) / sizeof(sleep_policies[0]);
 
 #define LARGE 10
 #define SMALL 4
@@ -109,13 +157,30 @@ enum star_size {
 };
 
 /* Function prototypes */
-bool getTodaysWeather(void);
-bool getWeatherForecast(void);
-bool getTodaysWater(void);
+bool getTodaysWeather(HttpsSession &http, GzipStream &gunzip, const HttpValidator *known);
+bool getWeatherForecast(HttpsSession &http, GzipStream &gunzip, const HttpValidator *known);
+Stream *responseBody(HttpsSession &http, GzipStream &gunzip);
+bool getTodaysWater(HttpsSession &http);
+bool parseStation(Stream &in, struct WaterStruct &out);
+bool parseMeasurement(const char *json, size_t len, const struct WaterSeries &series, struct WaterStruct &out);
+bool parseStationSeries(Stream &in, struct WaterStruct &out);
+int nextJsonChar(Stream &in);
+int peekJsonChar(Stream &in);
+bool readJsonString(Stream &in, char *out, size_t size);
+int skipJsonValue(Stream &in);
+uint8_t fetchOpenWeatherMap(uint8_t stale);
+uint8_t fetchPegelonline(uint8_t stale);
 bool getDailyWeatherForecast(void);
+bool isCacheFresh(int source, time_t now);
+bool isCacheIntact(int source);
+void updateCache(int source);
 static void updateLocalTime(void);
 void initialiseDisplay(void);
 void goToSleep(void);
+bool connectWifi(void);
+void startNtp(void);
+void checkClock(time_t server);
+void measureWakeLatency(void);
 static uint32_t readADC_Cal(const int adc_raw);
 uint32_t getBatteryVoltage(void);
 int calculateBatteryPercentage(double v);
@@ -123,15 +188,23 @@ void displayBattery(int x, int y);
 void logWakeupReason(void);
 void displayErrorMessage(String message);
 void displayWifiErrorMessage(void);
-void drawString(int x, int y, String text, alignment align);
+void renderErrorMessage(String message);
+void renderWifiErrorMessage(void);
+void drawString(int x, int y, const char *text, alignment align);
+void drawString(int x, int y, const String &text, alignment align);
 void displayInformation(void);
+void renderInformation(void);
+void loadRenderFixture(void);
+void reportRenderStats(uint32_t render_us);
+void printIconAtlas(void);
+void updateDisplay(bool partial_allowed);
 void displayTemperature(int x, int y);
 void displayWater(int x, int y);
 void displayCloudCover(int x, int y, int cover);
 void addCloud(int x, int y, int scale, int linesize);
 void displaySystemInfo(int x, int y);
 void displayWind(int x, int y, float angle, float windspeed, int radius);
-void arrow(int x, int y, int asize, float aangle, int pwidth, int plength, uint16_t colour);
+void arrow(int x, int y, int asize, int aangle, int pwidth, int plength, uint16_t colour);
 String windDegToDirection(float winddirection);
 String titleCase(String text);
 void displayWeatherDescription(int x, int y);
@@ -139,22 +212,29 @@ String convertUnixTime(uint32_t unix_time);
 void displaySunAndMoon(int x, int y);
 //int julianDate(int d, int m, int y);
 void displayWeatherForecast(int x, int y);
+void displayCurrentWeather(int x, int y);
+void displayCurrentWind(int x, int y);
+void displayPressureGraph(int x, int y);
+void drawPanelBorders(void);
 void displaySingleForecast(int x, int y, int offset, int index);
-void displayWeatherIcon(int x, int y, String icon, bool icon_size);
+weather_icon parseWeatherIcon(const char *code);
+water_state parseWaterState(const char *state);
+void displayWeatherIcon(int x, int y, weather_icon icon, bool icon_size);
+void blitIcon(int x, int y, const struct icon_bitmap &bitmap);
 void addMoon(int x, int y, int scale);
 void addSun(int x, int y, int scale, boolean icon_size, uint16_t icon_color);
-void noData(int x, int y, bool large_size);
-void sunnyIcon(int x, int y, bool large_size, String icon_name, uint16_t icon_color);
-void mostlySunnyIcon(int x, int y, bool large_size, String icon_name, uint16_t icon_color);
-void cloudyIcon(int x, int y, bool large_size, String icon_name);
-void veryCloudyIcon(int x, int y, bool large_size, String icon_name);
-void chanceOfRainIcon(int x, int y, bool large_size, String icon_name, uint16_t icon_color);
-void rainIcon(int x, int y, bool large_size, String icon_name);
-void thunderStormIcon(int x, int y, bool large_size, String icon_name);
-void snowIcon(int x, int y, bool large_size, String icon_name);
-void mistIcon(int x, int y, bool large_size, String icon_name);
-// void fogIcon(int x, int y, bool large_size, String icon_name);
-// void hazeIcon(int x, int y, bool large_size, String icon_name, uint16_t icon_color);
+void noData(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color);
+void sunnyIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color);
+void mostlySunnyIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color);
+void cloudyIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color);
+void veryCloudyIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color);
+void chanceOfRainIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color);
+void rainIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color);
+void thunderStormIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color);
+void snowIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color);
+void mistIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color);
+// void fogIcon(int x, int y, bool large_size, weather_icon icon);
+// void hazeIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color);
 void sunRiseSetIcon(uint16_t x, uint16_t y, sun_direction direction);
 void addCloud(int x, int y, int scale, int linesize);
 void addRain(int x, int y, int scale, uint16_t colour);
@@ -162,82 +242,251 @@ void addSnow(int x, int y, int scale, uint16_t colour);
 void addThunderStorm(int x, int y, int scale, uint16_t colour);
 void addFog(int x, int y, int scale, int linesize, uint16_t colour);
 void addStar(int x, int y, star_size starsize);
-void drawGraph(uint16_t x, uint16_t y, uint16_t w, uint16_t h, float Data[], float Data2[], int len, String title);
-void drawSingleGraph(uint16_t x, uint16_t y, uint16_t w, uint16_t h, float Data[], int len, String title);
+
+/*
+ * One data series of a graph, a view of a float field in an array of structs (or of a plain
+ * float array) so e.g. weather history or forecast columns can be plotted without copying.
+ */
+enum graph_style : uint8_t {
+    GRAPH_LINE,  // 2 pixel line
+    GRAPH_AREA   // 1 pixel line with the area below it filled
+};
+
+typedef struct GraphSeries {
+    const uint8_t *base; // first value
+    size_t stride;       // bytes from one value to the next
+    graph_style style;
+
+    float operator[](int i) const { return *(const float *)(base + i * stride); }
+} GraphSeries;
+
+/**
+ * @brief View of a float field of an array of structs, e.g. seriesOf(history, &WeatherStruct::pressure)
+ */
+template <typename T>
+GraphSeries seriesOf(const T *items, float T::*field, graph_style style = GRAPH_LINE) {
+    return {(const uint8_t *)&(items->*field), sizeof(T), style};
+}
+
+/**
+ * @brief View of a float array, e.g. seriesOf(forecast.pressure)
+ */
+inline GraphSeries seriesOf(const float *values, graph_style style = GRAPH_LINE) {
+    return {(const uint8_t *)values, sizeof(float), style};
+}
+
+void drawGraphSeries(int x, int y, int w, int h, const GraphSeries *series, int count, int len, const char *title);
+
+/**
+ * @brief Draw a graph of any number of series, see drawGraphSeries()
+ */
+template <size_t N>
+void drawGraph(int x, int y, int w, int h, const GraphSeries (&series)[N], int len, const char *title) {
+    drawGraphSeries(x, y, w, h, series, N, len, title);
+}
 
 /* Globals etc. */
 WiFiClientSecure wifiClient;
 
-String ipAddress = "0:0:0:0";
-int rssi = 0;
-
-// current
-typedef struct WeatherStruct {
-    // pressure_trend   trend = LEVEL;
-    uint8_t humidity = 0;
-    uint8_t clouds = 0;
-    uint16_t wind_deg = 0;
-    uint32_t dt = 0;
-    uint32_t sunrise = 0;
-    uint32_t sunset = 0;
-    uint32_t visibility = 0;
-    float temperature = 0;
-    float high = 0;
-    float low = 0;
-    float feels_like = 0;
-    float pressure = 0;
-    float dew_point = 0;
-    float uvi = 0;
-    float wind_speed = 0;
-    float wind_gust = 0;
-    float rain = 0;
-    float snow = 0;
-    String main;
-    String description;
-    String icon;
-    String period;
-} WeatherStruct;
-
-WeatherStruct weather;
-WeatherStruct forecast[forecast_counter];
-
-// water data 
-typedef struct WaterStruct {
-    String station; //station name
-    String height_longname; // WASSERSTAND_ROHDATEN
-    String height_unit; // cm
-    float height = 0;
-    String height_timestamp; // timestamp "2024-09-10T08:30:00+02:00"
-    String height_stateMnwMhw; // "normal"
-    String height_stateNswHsw; // "normal"
-
-    String temp_longname; // "WASSERTEMPERATUR"
-    String temp_unit; // "°C"
-    float temp = 0; //22.6
-    String temp_timestamp; // "2024-09-10T08:30:00+02:00"
-
-    String speed_longname; // "ABFLUSS"
-    String speed_unit; // "m³/s"
-    float speed = 0; //92.0
-    String speed_timestamp; // "2024-09-10T08:30:00+02:00"
-} WaterStruct;
-
-WaterStruct water;
-
-
-char timeStringBuff[7]; // buffer for time on the display
-char dateStringBuff[4];
-char dayStringBuff[10];
+// Everything is rendered into this frame buffer first and then sent to the panel
+#if RENDER_STATS
+CountingCanvas frame(SCREEN_WIDTH, SCREEN_HEIGHT);
+#else
+TextCanvas frame(SCREEN_WIDTH, SCREEN_HEIGHT);
+#endif
+const size_t FRAME_BYTES = (SCREEN_WIDTH + 7) / 8 * SCREEN_HEIGHT;
+RTC_DATA_ATTR TextWidthCache text_widths; // sizes of the strings drawn recently, most labels repeat every render
+
+RTC_DATA_ATTR uint32_t frame_crc = 0;          // crc of the frame currently on the panel
+RTC_DATA_ATTR uint32_t skipped_refreshes = 0;  // panel refreshes saved because the frame was unchanged
+
+/*
+ * Screen layout of displayInformation(). Each panel gets a 1 pixel border and is drawn by its
+ * widget, which is called with the panel's anchor point (the widgets take absolute coordinates).
+ * Neighbouring panels leave a 1 pixel gap between their borders, that gives the double lines of
+ * the grid. The panels are also the regions of partial refreshes: each keeps the crc of its part
+ * of the frame on the panel so only the panels that changed are sent. Every
+ * FULL_REFRESH_INTERVAL updates a full refresh is done instead to clear the ghosting.
+ *
+ * Another layout can be compiled in with -D PANEL_LAYOUT='"layout.h"', a header that defines
+ * its own panels[] table.
+ */
+typedef void (*panel_widget_fn)(int x, int y);
+
+typedef struct Panel {
+    int16_t x;               // border box, the border is drawn on its outermost pixels
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    panel_widget_fn widget;  // draws the panel contents
+    int16_t ax;              // anchor point passed to the widget
+    int16_t ay;
+} Panel;
+
+#ifdef PANEL_LAYOUT
+#include PANEL_LAYOUT
+#else
+constexpr Panel panels[] = {
+    {0, 0, 146, 111, displayTemperature, 0, 0},
+    {147, 0, 130, 111, displayCurrentWeather, 146, -13},
+    {278, 0, 122, 111, displayCurrentWind, 325, 39},
+    {0, 112, 120, 75, displaySunAndMoon, 2, 114},
+    {121, 112, 279, 75, displayWeatherForecast, 118, 115},
+    {0, 188, 120, 112, displayWater, 0, 0},
+    {121, 188, 142, 112, displayPressureGraph, 155, 209},
+    {264, 188, 136, 112, displaySystemInfo, 295, 185}
+};
+#endif
+const int PANEL_COUNT = sizeof(panels) / sizeof(panels[0]);
+const int FULL_REFRESH_INTERVAL = 12;
+
+RTC_DATA_ATTR uint32_t box_crc[PANEL_COUNT];     // crc of each panel's box on the display, all 0 = unknown
+RTC_DATA_ATTR int partial_refreshes = 0;         // partial refreshes since the last full refresh
+
+uint32_t boxCrc(const Panel &box);
+
+RTC_DATA_ATTR char ipAddress[16] = "0:0:0:0"; // kept in RTC memory, shown when wifi is skipped
+RTC_DATA_ATTR int rssi = 0;
+
+// Fetched data, kept in RTC memory across deep sleep (the structs are in weatherData.h)
+RTC_DATA_ATTR WeatherStruct weather;
+RTC_DATA_ATTR ForecastStore forecast;
+
+#ifndef WATER_STATIONS
+#error "WATER_STATIONS missing in config.h, see config_example.h"
+#endif
+
+  // pegelonline stations from config.h, all fetched on one connection and shown in turn
+const char *const water_stations[] = {WATER_STATIONS};
+const int WATER_STATION_COUNT = sizeof(water_stations) / sizeof(water_stations[0]);
+const int WATER_STATION_MAX = 4;    // each station keeps a WaterStruct in RTC memory
+static_assert(WATER_STATION_COUNT <= WATER_STATION_MAX, "too many WATER_STATIONS");
+
+RTC_DATA_ATTR WaterStruct water[WATER_STATION_COUNT];
+RTC_DATA_ATTR uint8_t water_page = 0;   // station displayWater() shows, moves on with every display update
+
+// No heap pointers in the data structs, so they can be copied byte for byte (RTC memory, flash)
+static_assert(std::is_trivially_copyable<WeatherStruct>::value, "WeatherStruct must stay trivially copyable");
+static_assert(std::is_trivially_copyable<WaterStruct>::value, "WaterStruct must stay trivially copyable");
+
+/*
+ * Data cache. weather, forecast and water live in RTC memory and survive deep sleep, each
+ * source records when it was fetched and a crc of its bytes. A source is only fetched again
+ * once its ttl has run out (or the crc no longer matches), if nothing is stale wifi stays off.
+ */
+enum data_source {
+    SOURCE_WEATHER,
+    SOURCE_FORECAST,
+    SOURCE_WATER,
+    SOURCE_COUNT
+};
+
+const CacheSource cache_sources[SOURCE_COUNT] = {
+    {"weather", &weather, sizeof(weather), 10 * 60, 10 * 60, 60},               // OWM updates current weather every ~10 minutes
+    {"forecast", &forecast, sizeof(forecast), 3 * 60 * 60, 3 * 60 * 60, 10 * 60}, // OWM forecasts move on 3 hour steps
+    {"water", water, sizeof(water), 15 * 60, 15 * 60, 5 * 60}                   // pegelonline measures every 15 minutes
+};
+
+RTC_DATA_ATTR CacheStruct cache[SOURCE_COUNT];
+
+const time_t VALID_TIME = 1700000000; // anything before this means the clock was never set
+
+/*
+ * The RTC keeps running in deep sleep, so NTP is only asked every few hours. In between the clock is
+ * checked against the Date header of the OpenWeatherMap responses and set from it when it has drifted.
+ */
+const time_t NTP_RESYNC_INTERVAL = 6 * 3600;  // s between NTP syncs
+const long NTP_MAX_DRIFT = 30;                 // s the clock may be off from the HTTP Date before it is corrected
+
+RTC_DATA_ATTR time_t last_ntp_sync = 0;        // unix time of the last NTP sync, 0 = sync on the next wake
+volatile bool ntp_synced = false;              // NTP synced the clock during this wake
+time_t server_time = 0;                        // Date of the last OpenWeatherMap response, 0 = none
+double ntp_start_clock = 0;                    // clock when the NTP sync was started...
+uint32_t ntp_start_us = 0;                     // ...and micros() at that point
+
+/*
+ * Sleep scheduler (nextWakeTime() in wakeSchedule.cpp). The next wake is put just after the
+ * next publication of a source whose cache has run out, but no earlier than the interval of
+ * the current SleepPolicy allows. The timer is shortened by the learned wake latency (timer
+ * expiry to setup()) and scaled by the learned drift of the RTC against NTP/HTTP time.
+ */
+const time_t DRIFT_MIN_SPAN = 3600;     // s the clock must have run unset before its drift is measured
+const float DRIFT_MAX_PPM = 20000;      // measurements beyond this are treated as bogus
+const time_t MIN_SLEEP = 60;            // s to sleep at least
+
+RTC_DATA_ATTR time_t clock_ref = 0;            // time the clock was last set from NTP/HTTP, 0 = unknown
+RTC_DATA_ATTR float rtc_drift_ppm = 0;         // real time gained on the RTC per 10^6 s, > 0 = RTC slow
+RTC_DATA_ATTR time_t wake_target = 0;          // unix time the current sleep is meant to end at, 0 = none
+RTC_DATA_ATTR int32_t wake_latency_ms = 0;     // how late setup() starts after wake_target
+
+/*
+ * Fetch stage. There is one job per host, a job fetches all stale sources of its host over
+ * a single keep-alive connection. The jobs run in their own tasks so the TLS handshakes and
+ * downloads of the different hosts overlap. A task is only started while there is heap left
+ * for another TLS session, otherwise the stage first waits for a running job to finish.
+ */
+enum fetch_host {
+    HOST_OPENWEATHERMAP,
+    HOST_PEGELONLINE,
+    HOST_COUNT
+};
+
+#define SOURCE_BIT(source) (1 << (source))
+
+typedef struct FetchJob {
+    const char *name;
+    uint8_t (*fetch)(uint8_t stale);    // fetches the given sources, returns the ones that succeeded
+    uint8_t sources;            // SOURCE_BIT()s of the sources served by this host
+    uint8_t stale;              // in: SOURCE_BIT()s of the sources to fetch
+    uint8_t ok;                 // out: SOURCE_BIT()s of the sources fetched successfully
+    uint32_t ms;                // out: time the job took
+    EventGroupHandle_t done;
+    EventBits_t bit;
+} FetchJob;
+
+// TLS session of each host, resumed on the next wake instead of doing a full handshake
+RTC_DATA_ATTR TlsSessionCache tls_sessions[HOST_COUNT];
+
+const uint32_t FETCH_STACK_SIZE = 16 * 1024;  // the HttpsSession with its TLS contexts lives on the task stack
+const uint32_t FETCH_HEAP_NEEDED = 64 * 1024; // TLS buffers, JSON document and task stack
+
+void fetchSources(FetchJob jobs[HOST_COUNT]);
+
+
+/*
+ * Access point and addresses of the last good connection. The next wake joins the same BSSID on the
+ * same channel with the same static addresses, which skips the scan and DHCP.
+ */
+typedef struct WifiCache {
+    uint8_t bssid[6];
+    int32_t channel;    // 0 = nothing cached, do a full scan and DHCP
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+} WifiCache;
+
+RTC_DATA_ATTR WifiCache wifi_cache;
+
+const uint32_t WIFI_FAST_TIMEOUT = 3000;  // ms to wait for a connect with the cached settings
+const uint32_t WIFI_FULL_TIMEOUT = 15000; // ms to wait for a connect with scan and DHCP
+
+#define WIFI_CONNECTED_BIT (1 << 0)
+#define WIFI_FAILED_BIT (1 << 1)
+
+EventGroupHandle_t wifi_events;
+
+// Time of the last reading, kept in RTC memory so a wake without fetching shows the same frame
+RTC_DATA_ATTR char timeStringBuff[7]; // buffer for time on the display
+RTC_DATA_ATTR char dateStringBuff[4];
+RTC_DATA_ATTR char dayStringBuff[10];
 
 void setup() {
-    int wifi_connect_counter = 0;
-    bool wifi_connected = true;
-    
 	// Ensure power LED is off to save power.
     pinMode(LED_PIN, OUTPUT);
     digitalWrite(LED_PIN, LOW);
     
-    #if CLOG_ENABLE
+    #if CLOG_ENABLE || RENDER_STATS || ICON_ATLAS_GENERATE
     Serial.begin(115200);
     delay(5000); // delay for serial to begin, T7-S3 is very slow to start serial output!
 	
@@ -246,6 +495,17 @@ void setup() {
 
     initialiseDisplay();
 
+    #if ICON_ATLAS_GENERATE
+    printIconAtlas();
+    goToSleep(); // does not return
+    #endif
+
+    #if RENDER_FIXTURE
+    loadRenderFixture();
+    displayInformation();
+    goToSleep(); // does not return
+    #endif
+
     // Serial.println("\n##################################");
     // Serial.println(F("ESP32 Information:"));
     // Serial.printf("Internal Total Heap %d, Internal Used Heap %d, Internal Free Heap %d\n", ESP.getHeapSize(), ESP.getHeapSize()-ESP.getFreeHeap(), ESP.getFreeHeap());
@@ -255,58 +515,96 @@ void setup() {
     // Serial.printf("Flash Size %d, Flash Speed %d\n", ESP.getFlashChipSize(), ESP.getFlashChipSpeed());
     // Serial.println("##################################\n");
 
-    WiFi.disconnect();
+    // The RTC keeps running in deep sleep, only the timezone has to be set again
+    setenv("TZ", TIMEZONE, 1);
+    tzset();
 
-    WiFi.mode(WIFI_STA); // switch off AP
-    WiFi.setAutoReconnect(true);
-
-    WiFi.begin(SSID, WIFI_PASSWORD);
-    while (WiFi.status() != WL_CONNECTED)
-    {
-        delay(500);
-        // Serial.print(".");
+    measureWakeLatency();
 
-        wifi_connect_counter++;
+    // Only the sources whose cached copy has expired are fetched
+    time_t now = time(NULL);
+    uint8_t stale = 0;
 
-        // Give the wifi a few seconds to connect
-        if (wifi_connect_counter > 30) {
-            wifi_connected = false;
-            break;
+    for (int i = 0; i < SOURCE_COUNT; i++) {
+        if (!isCacheFresh(i, now)) {
+            stale |= SOURCE_BIT(i);
         }
     }
-    
-    if (wifi_connected) {
+
+    if (!stale) {
+        CLOG(myLog1.add(), "All data cached, wifi not needed");
+
+        battery_voltage = getBatteryVoltage();
+        displayInformation();
+        goToSleep(); // does not return
+    }
+
+    if (connectWifi()) {
         // Serial.println("");
         // Serial.println("Connecting to Wi-Fi...");
 
-        ipAddress = WiFi.localIP().toString();
+        strlcpy(ipAddress, WiFi.localIP().toString().c_str(), sizeof(ipAddress));
         rssi = WiFi.RSSI();
         //Serial.println(ipAddress);
         CLOG(myLog1.add(), "IP Address: %s", ipAddress);
 
-        //Serial.println("Connecting to NTP Time Server...");
-        configTime(0, 0, SNTP_TIME_SERVER);
+        startNtp();
 
-        // Set timezone - London
-        // setenv("TZ", "GMT0BST,M3.5.0/1,M10.5.0", 1);
-        // Set timezone - Germany for us: CET-1CEST,M3.5.0,M10.5.0/3
-        setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
-        tzset();
+        //Serial.println("All set up, display some information...");
+        CLOG(myLog1.add(), "Setup complete...");
 
+        FetchJob jobs[HOST_COUNT] = {
+            {"openweathermap", fetchOpenWeatherMap, SOURCE_BIT(SOURCE_WEATHER) | SOURCE_BIT(SOURCE_FORECAST)},
+            {"pegelonline", fetchPegelonline, SOURCE_BIT(SOURCE_WATER)}
+        };
+
+        for (int i = 0; i < HOST_COUNT; i++) {
+            jobs[i].stale = stale & jobs[i].sources;
+        }
+
+        uint32_t fetch_start = millis();
+        fetchSources(jobs);
+        CLOG(myLog1.add(), "Fetch stage took %lu ms", millis() - fetch_start);
+
+        checkClock(server_time);
         updateLocalTime();
 
-        //Serial.println("All set up, display some information...");
-        CLOG(myLog1.add(), "Setup complete...");
+        uint8_t ok = 0;
+        for (int i = 0; i < HOST_COUNT; i++) {
+            if (jobs[i].stale) {
+                CLOG(myLog1.add(), "Fetch %s took %lu ms", jobs[i].name, (unsigned long)jobs[i].ms);
+                CLOG(myLog1.add(), "TLS %s %u resumed/%u full", jobs[i].name, tls_sessions[i].resumed, tls_sessions[i].full);
+                if (tls_sessions[i].needed) {
+                    CLOG(myLog1.add(), "TLS %s session needs %u bytes, TLS_SESSION_BYTES is %u, not resumed", jobs[i].name,
+                         tls_sessions[i].needed, (unsigned)TLS_SESSION_BYTES);
+                }
+                ok |= jobs[i].ok;
+            }
+        }
+
+        for (int i = 0; i < SOURCE_COUNT; i++) {
+            if (stale & SOURCE_BIT(i)) {
+                CLOG(myLog1.add(), "Fetch %s %s", cache_sources[i].name, (ok & SOURCE_BIT(i)) ? "ok" : "FAILED");
+                if (ok & SOURCE_BIT(i)) {
+                    updateCache(i);
+                }
+            }
+        }
+
+        // Nothing came through, maybe the cached addresses are no longer valid
+        if (!ok) {
+            wifi_cache.channel = 0;
+        }
 
-        bool today_flag = getTodaysWeather();
-        bool forecast_flag = getWeatherForecast();
-        bool waterdata_flag = getTodaysWater();
+        bool today_flag = !(stale & SOURCE_BIT(SOURCE_WEATHER)) || (ok & SOURCE_BIT(SOURCE_WEATHER));
+        bool forecast_flag = !(stale & SOURCE_BIT(SOURCE_FORECAST)) || (ok & SOURCE_BIT(SOURCE_FORECAST));
+        bool waterdata_flag = !(stale & SOURCE_BIT(SOURCE_WATER)) || (ok & SOURCE_BIT(SOURCE_WATER));
 
         /*
         // DEBUG WATERDATA DANIEL:
         Serial.print("waterdata_flag:");Serial.println(waterdata_flag);
-        Serial.print("water measurements station:");Serial.println(water.station);
-        Serial.print("water temperature:");Serial.println(water.temp);
+        Serial.print("water measurements station:");Serial.println(water[0].station);
+        Serial.print("water temperature:");Serial.println(water[0].temp);
         */
 
         // Turn off wifi to save power
@@ -336,6 +634,89 @@ void setup() {
     goToSleep();
 }
 
+/**
+ * @brief Wifi event handler, wakes up connectWifi() when the connect attempt is over.
+ * 
+ * @param event Wifi event
+ */
+static void wifiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+        xEventGroupSetBits(wifi_events, WIFI_CONNECTED_BIT);
+    } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+        xEventGroupSetBits(wifi_events, WIFI_FAILED_BIT);
+    }
+}
+
+/**
+ * @brief Wait for the running connect attempt to finish.
+ * 
+ * @param timeout ms to wait at most
+ * @param stop_on_failure Give up on the first disconnect instead of letting the wifi retry
+ * @return true Connected and an IP address is set
+ * @return false Not connected
+ */
+static bool waitForWifi(uint32_t timeout, bool stop_on_failure) {
+    EventBits_t wait_for = WIFI_CONNECTED_BIT | (stop_on_failure ? WIFI_FAILED_BIT : 0);
+    EventBits_t bits = xEventGroupWaitBits(wifi_events, wait_for, pdTRUE, pdFALSE, pdMS_TO_TICKS(timeout));
+
+    return (bits & WIFI_CONNECTED_BIT) != 0;
+}
+
+/**
+ * @brief Connect to the wifi. The access point and addresses of the last good connection are
+ * tried first, if that fails a full scan and DHCP are done. The settings of a successful
+ * connection are kept for the next wake.
+ * 
+ * @return true Connected
+ * @return false Unable to connect
+ */
+bool connectWifi(void) {
+    uint32_t start = millis();
+    bool fast = (wifi_cache.channel != 0);
+    bool connected = false;
+
+    wifi_events = xEventGroupCreate();
+    WiFi.onEvent(wifiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(wifiEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+
+    WiFi.persistent(false); // settings come from RTC memory, don't wear the flash
+    WiFi.mode(WIFI_STA);    // switch off AP
+    WiFi.setAutoReconnect(true);
+
+    if (fast) {
+        WiFi.config(IPAddress(wifi_cache.ip), IPAddress(wifi_cache.gateway), IPAddress(wifi_cache.subnet), IPAddress(wifi_cache.dns));
+        WiFi.begin(SSID, WIFI_PASSWORD, wifi_cache.channel, wifi_cache.bssid);
+        connected = waitForWifi(WIFI_FAST_TIMEOUT, true);
+
+        if (!connected) {
+            CLOG(myLog1.add(), "Cached wifi settings failed");
+            WiFi.disconnect();
+            WiFi.config(IPAddress(), IPAddress(), IPAddress()); // back to DHCP
+            xEventGroupClearBits(wifi_events, WIFI_CONNECTED_BIT | WIFI_FAILED_BIT);
+            fast = false;
+        }
+    }
+
+    if (!connected) {
+        WiFi.begin(SSID, WIFI_PASSWORD);
+        connected = waitForWifi(WIFI_FULL_TIMEOUT, false);
+    }
+
+    if (connected) {
+        memcpy(wifi_cache.bssid, WiFi.BSSID(), sizeof(wifi_cache.bssid));
+        wifi_cache.channel = WiFi.channel();
+        wifi_cache.ip = WiFi.localIP();
+        wifi_cache.gateway = WiFi.gatewayIP();
+        wifi_cache.subnet = WiFi.subnetMask();
+        wifi_cache.dns = WiFi.dnsIP();
+        CLOG(myLog1.add(), "Wifi (%s) connected in %lu ms", fast ? "cached" : "scan", millis() - start);
+    } else {
+        wifi_cache.channel = 0;
+    }
+
+    return connected;
+}
+
 /**
  * @brief Main loop which we will never enter as we enter deep sleep once we've updated
  * the display.
@@ -356,35 +737,31 @@ void loop() {
  * 
  */
 void goToSleep(void) {
-    long sleep_timer = sleep_duration * 60;
+    int64_t sleep_us = sleep_duration * 60 * 1000000LL;
 
     struct tm timeinfo;
 
     // display.powerOff(); // should be in hibernate but no harm tuning it off
     display.hibernate(); // turns powerOff() and sets controller to deep sleep for minimum power use
-    getLocalTime(&timeinfo);
 
-    if (timeinfo.tm_hour >= sleep_hour || timeinfo.tm_hour < wakeup_hour)
-    {
-        sleep_timer = 7200;
+    time_t now = time(NULL);
+    wake_target = 0;
 
-        if (timeinfo.tm_hour < wakeup_hour && (timeinfo.tm_hour + (sleep_timer / 3600)) > wakeup_hour)
-        {
-            sleep_timer = (wakeup_hour * 3600) - ((timeinfo.tm_hour * 3600) + (timeinfo.tm_min * 60) + timeinfo.tm_sec);
-            if (sleep_timer < (sleep_duration * 60))
-            {
-                sleep_timer = sleep_timer + sleep_duration * 60;
-            }
-        }
-    }
+    if (now >= VALID_TIME && localtime_r(&now, &timeinfo) != NULL) {
+        // Where the clock actually is, going by the drift since it was last set
+        double real_now = correctedTime(now, clock_ref, rtc_drift_ppm);
 
-    if (sleep_timer < sleep_duration * 60)
-    {
-        sleep_timer = sleep_duration * 60;
+        wake_target = nextWakeTime(now, timeinfo, sleep_policies, SLEEP_POLICY_COUNT, cache, cache_sources, SOURCE_COUNT);
+        double sleep_s = (wake_target - real_now) / (1 + rtc_drift_ppm / 1e6) - wake_latency_ms / 1000.0;
+        if (sleep_s < MIN_SLEEP) {
+            sleep_s = MIN_SLEEP;
+        }
+        sleep_us = (int64_t)(sleep_s * 1e6);
     }
-    esp_sleep_enable_timer_wakeup(sleep_timer * 1000000LL);
+    esp_sleep_enable_timer_wakeup(sleep_us);
 
-    CLOG(myLog1.add(), "Off to deep-sleep for %ld minutes", sleep_timer/60);
+    CLOG(myLog1.add(), "Off to deep-sleep for %ld s", (long)(sleep_us / 1000000));
+    CLOG(myLog1.add(), "Drift %.0f ppm, latency %ld ms", rtc_drift_ppm, (long)wake_latency_ms);
 
     #if CLOG_ENABLE
     Serial.println("");
@@ -398,6 +775,28 @@ void goToSleep(void) {
     esp_deep_sleep_start();
 }
 
+/**
+ * @brief After a timer wake, measure how late setup() started compared to the time the
+ * sleep was meant to end at and correct the learned wake latency by it. wake_target is
+ * real time, so it is compared with the drift corrected clock, as goToSleep() did.
+ */
+void measureWakeLatency(void) {
+    struct timeval tv;
+
+    if (esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_TIMER || wake_target < VALID_TIME) {
+        return;
+    }
+
+    gettimeofday(&tv, NULL);
+    double real_now = correctedTime(tv.tv_sec + tv.tv_usec / 1e6, clock_ref, rtc_drift_ppm);
+    int32_t late_ms = (int32_t)((real_now - wake_target) * 1000);
+    if (late_ms > -60000 && late_ms < 60000) {
+        // The timer was already shortened by wake_latency_ms, so late_ms is what's left to correct
+        wake_latency_ms = constrain(wake_latency_ms + late_ms / 4, 0, 10000);
+    }
+    CLOG(myLog1.add(), "Woke %ld ms after target", (long)late_ms);
+}
+
 /**
  * @brief Log (cLog) why we've woken up.
  * 
@@ -417,6 +816,191 @@ void logWakeupReason(void) {
     }
 }
 
+/**
+ * @brief Check if the cached copy of a data source can be used without fetching it again.
+ * 
+ * @param source Data source, one of data_source
+ * @param now Current unix time
+ * @return true The data was fetched within its ttl and is intact
+ * @return false The data has to be fetched
+ */
+bool isCacheFresh(int source, time_t now) {
+    const CacheSource &src = cache_sources[source];
+
+    if (now < VALID_TIME || cache[source].fetched < VALID_TIME || now < (time_t)cache[source].fetched) {
+        return false;
+    }
+    if (now - cache[source].fetched >= src.ttl) {
+        CLOG(myLog1.add(), "Cache %s expired", src.name);
+        return false;
+    }
+    if (crc32_le(0, (const uint8_t *)src.data, src.size) != cache[source].crc) {
+        CLOG(myLog1.add(), "Cache %s corrupt", src.name);
+        return false;
+    }
+
+    CLOG(myLog1.add(), "Cache %s fresh, %ld s old", src.name, (long)(now - cache[source].fetched));
+    return true;
+}
+
+/**
+ * @brief Check the cached copy of a data source is still what was stored, however old it is.
+ * Only then can a conditional request (or a matching body crc) stand in for the data.
+ * 
+ * @param source Data source, one of data_source
+ * @return true The data was fetched once and its crc matches
+ */
+bool isCacheIntact(int source) {
+    const CacheSource &src = cache_sources[source];
+
+    return cache[source].fetched != 0 && crc32_le(0, (const uint8_t *)src.data, src.size) == cache[source].crc;
+}
+
+/**
+ * @brief Record a successful fetch of a data source in the cache.
+ * 
+ * @param source Data source, one of data_source
+ */
+void updateCache(int source) {
+    const CacheSource &src = cache_sources[source];
+
+    cache[source].fetched = time(NULL);
+    cache[source].crc = crc32_le(0, (const uint8_t *)src.data, src.size);
+}
+
+/**
+ * @brief Task running a single job of the fetch stage.
+ * 
+ * @param param FetchJob to run
+ */
+static void fetchTask(void *param) {
+    FetchJob *job = (FetchJob *)param;
+    uint32_t start = millis();
+
+    job->ok = job->fetch(job->stale);
+    job->ms = millis() - start;
+
+    xEventGroupSetBits(job->done, job->bit);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Run the jobs of all hosts with stale sources concurrently and wait for them to
+ * finish. The fetch functions each write their own global (weather, forecast, water)
+ * so they don't need any locking.
+ * 
+ * @param jobs One job per host, only the ones with stale sources are run
+ */
+void fetchSources(FetchJob jobs[HOST_COUNT]) {
+    EventGroupHandle_t done = xEventGroupCreate();
+    EventBits_t started = 0;
+    EventBits_t finished = 0;
+
+    for (int i = 0; i < HOST_COUNT; i++) {
+        if (!jobs[i].stale) {
+            continue;
+        }
+
+        // Not enough heap for another TLS session, wait for a running fetch to release its buffers
+        while (started != finished && ESP.getFreeHeap() < FETCH_HEAP_NEEDED) {
+            finished |= xEventGroupWaitBits(done, started & ~finished, pdFALSE, pdFALSE, portMAX_DELAY) & started;
+        }
+
+        jobs[i].done = done;
+        jobs[i].bit = 1 << i;
+
+        if (xTaskCreatePinnedToCore(fetchTask, jobs[i].name, FETCH_STACK_SIZE, &jobs[i], 1, NULL, i % portNUM_PROCESSORS) == pdPASS) {
+            started |= jobs[i].bit;
+        } else {
+            // No room for the task, fetch from here instead
+            uint32_t start = millis();
+            jobs[i].ok = jobs[i].fetch(jobs[i].stale);
+            jobs[i].ms = millis() - start;
+        }
+    }
+
+    if (started) {
+        xEventGroupWaitBits(done, started, pdFALSE, pdTRUE, portMAX_DELAY);
+    }
+    vEventGroupDelete(done);
+}
+
+/**
+ * @brief Update the RTC drift estimate when the clock is set from NTP or HTTP time,
+ * from how far the clock was off and how long it ran since it was last set.
+ * 
+ * @param clock Unix time the clock showed just before it was set
+ * @param actual Unix time it was set to
+ */
+static void learnDrift(double clock, double actual) {
+    if (clock_ref >= VALID_TIME && clock >= clock_ref + DRIFT_MIN_SPAN) {
+        float ppm = (actual - clock) * 1e6 / (clock - clock_ref);
+
+        if (fabs(ppm) < DRIFT_MAX_PPM) {
+            rtc_drift_ppm = (rtc_drift_ppm == 0) ? ppm : (3 * rtc_drift_ppm + ppm) / 4;
+        }
+    }
+    clock_ref = actual;
+}
+
+/**
+ * @brief SNTP callback, records when the clock was last synced.
+ * 
+ * @param tv Time the clock was set to
+ */
+static void ntpSynced(struct timeval *tv) {
+    double before = ntp_start_clock + (micros() - ntp_start_us) / 1e6;
+
+    learnDrift(before, tv->tv_sec + tv->tv_usec / 1e6);
+    last_ntp_sync = tv->tv_sec;
+    ntp_synced = true;
+}
+
+/**
+ * @brief Start an NTP sync if the clock has never been set or the last sync is too
+ * long ago. The sync runs in the background while the data is fetched, so the wake
+ * only waits for it (in updateLocalTime()) when the clock isn't valid yet.
+ */
+void startNtp(void) {
+    time_t now = time(NULL);
+
+    if (now >= VALID_TIME && last_ntp_sync >= VALID_TIME && now >= last_ntp_sync && now - last_ntp_sync < NTP_RESYNC_INTERVAL) {
+        return;
+    }
+
+    CLOG(myLog1.add(), "NTP sync, last %ld s ago", (long)(now - last_ntp_sync));
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    ntp_start_clock = tv.tv_sec + tv.tv_usec / 1e6;
+    ntp_start_us = micros();
+    sntp_set_time_sync_notification_cb(ntpSynced);
+    configTime(0, 0, SNTP_TIME_SERVER);
+    setenv("TZ", TIMEZONE, 1); // configTime() resets TZ
+    tzset();
+}
+
+/**
+ * @brief Compare the clock with the Date header of a server response and set it from
+ * the header if they are too far apart. The next wake then does a full NTP sync.
+ * 
+ * @param server Unix time from the Date header, 0 if there was none
+ */
+void checkClock(time_t server) {
+    if (server < VALID_TIME || ntp_synced) {
+        return;
+    }
+
+    long drift = (long)(server - time(NULL));
+    if (labs(drift) > NTP_MAX_DRIFT) {
+        struct timeval tv = {server, 0};
+
+        learnDrift(time(NULL), server);
+        settimeofday(&tv, NULL);
+        last_ntp_sync = 0;
+        CLOG(myLog1.add(), "Clock off by %ld s, set from HTTP", drift);
+    }
+}
+
 /**
  * @brief Get the battery voltage
  * 
@@ -426,6 +1010,12 @@ uint32_t getBatteryVoltage(void)
 {
     float v = 0.0;
     v = (readADC_Cal(analogRead(BAT_ADC))) * 2;
+
+    // Ignore ADC noise, otherwise the battery text alone changes the frame on every wake
+    if (fabs(v - last_battery_voltage) < BATTERY_NOISE_MV) {
+        v = last_battery_voltage;
+    }
+    last_battery_voltage = v;
     CLOG(myLog1.add(), "getBatteryVoltage: %f", v);
     return v;
 }
@@ -478,6 +1068,10 @@ static void updateLocalTime(void)
     if (!getLocalTime(&timeinfo)) {
         //Serial.println("Failed to obtain time");
         CLOG(myLog1.add(), "Failed to obtain time");
+        // Don't leave the time of an older reading on the display
+        strlcpy(timeStringBuff, "--:--", sizeof(timeStringBuff));
+        dateStringBuff[0] = '\0';
+        dayStringBuff[0] = '\0';
         return;
     }
 
@@ -489,134 +1083,500 @@ static void updateLocalTime(void)
 
 
 /**
- * @brief Get the Todays Water from pegelonline.wsv.de
- * https://www.pegelonline.wsv.de/webservices/rest-api/v2/stations/66ff3eb4-513b-478b-abd2-2f5126ea66fd.json?includeTimeseries=true&includeCurrentMeasurement=true
+ * @brief Fetch the stale OpenWeatherMap sources. Both requests are sent back to back on one
+ * keep-alive connection, so there is only one TLS handshake per wake. The requests are
+ * conditional, only a 304 skips a source: the crc of a 200 body is known once all of it has
+ * been parsed, so there is nothing left to save by comparing it.
  * 
- * @return true If we successfully retrieved the weather
- * @return false If we failed to retrieve the weather
+ * @param stale SOURCE_BIT()s of the sources to fetch
+ * @return uint8_t SOURCE_BIT()s of the sources fetched successfully
  */
-bool getTodaysWater(void)
+uint8_t fetchOpenWeatherMap(uint8_t stale)
 {
-    WiFiClientSecure client;
-    bool retcode = true;
-    int port = 443;
-    const char *host = "www.pegelonline.wsv.de";
+    HttpsSession http("api.openweathermap.org", &tls_sessions[HOST_OPENWEATHERMAP]);
+    GzipStream gunzip;      // one window for both bodies
+    uint8_t sent = 0;
+    uint8_t ok = 0;
+
+    // Only ask for gzip if the window fits, a gzip body can't be read without it
+    if (gunzip.reserve()) {
+        http.acceptGzip(true);
+    } else {
+        http.acceptGzip(false);
+        CLOG(myLog1.add(), "No heap for the gzip window, heap %u", (unsigned)ESP.getFreeHeap());
+    }
 
-    uint32_t dt = millis();
+    // Conditional on what we have, as long as that is still intact
+    const HttpValidator *weather_known = isCacheIntact(SOURCE_WEATHER) ? &cache[SOURCE_WEATHER].validator : NULL;
+    const HttpValidator *forecast_known = isCacheIntact(SOURCE_FORECAST) ? &cache[SOURCE_FORECAST].validator : NULL;
 
-    client.setInsecure(); // certificate is not checked
+    if ((stale & SOURCE_BIT(SOURCE_WEATHER)) && http.send(WEATHER_URL, weather_known)) {
+        sent |= SOURCE_BIT(SOURCE_WEATHER);
+    }
+    if ((stale & SOURCE_BIT(SOURCE_FORECAST)) && http.send(FORECAST_URL, forecast_known)) {
+        sent |= SOURCE_BIT(SOURCE_FORECAST);
+    }
+    if (sent != stale) {
+        CLOG(myLog1.add(), "HTTPS connection to OpenWeatherMap failed!");
+    }
 
-    if (!client.connect(host, port)) {
-        CLOG(myLog1.add(), "HTTPS[1] connection to www.pegelonline.wsv.de failed!");
-        return false;
+    // Responses arrive in the order the requests were sent
+    if ((sent & SOURCE_BIT(SOURCE_WEATHER)) && getTodaysWeather(http, gunzip, weather_known)) {
+        ok |= SOURCE_BIT(SOURCE_WEATHER);
+    }
+    if (http.date) {
+        server_time = http.date;
+    }
+    if ((sent & SOURCE_BIT(SOURCE_FORECAST)) && getWeatherForecast(http, gunzip, forecast_known)) {
+        ok |= SOURCE_BIT(SOURCE_FORECAST);
+    }
+    if (http.date) {
+        server_time = http.date;
     }
+    CLOG(myLog1.add(), "OpenWeatherMap: %lu bytes received", (unsigned long)http.received);
 
-    uint32_t timeout = millis();
-    char c = 0;
+    http.stop();
+    return ok;
+}
+
+#define WATER_STATION_PATH "/webservices/rest-api/v2/stations/"
+
+/*
+ * The series shown, each read from its own currentmeasurement endpoint (about 100 bytes) instead
+ * of the whole station with all its series. Names and units come from the station itself, which
+ * is only fetched when they aren't known yet (after power up).
+ */
+typedef struct WaterSeries {
+    const char *path;                           // currentmeasurement endpoint, after the station
+    float WaterStruct::*value;
+    char (WaterStruct::*timestamp)[26];
+    water_state WaterStruct::*stateMnwMhw;      // NULL if the series has no states
+    water_state WaterStruct::*stateNswHsw;
+} WaterSeries;
+
+const WaterSeries water_series[] = {
+    {"/W/currentmeasurement.json", &WaterStruct::height, &WaterStruct::height_timestamp,
+     &WaterStruct::height_stateMnwMhw, &WaterStruct::height_stateNswHsw},
+    {"/WT/currentmeasurement.json", &WaterStruct::temp, &WaterStruct::temp_timestamp, NULL, NULL},
+    {"/Q/currentmeasurement.json", &WaterStruct::speed, &WaterStruct::speed_timestamp, NULL, NULL}
+};
+
+const int WATER_SERIES_COUNT = sizeof(water_series) / sizeof(water_series[0]);
+
+  // {"timestamp":"2024-09-10T22:15:00+02:00","value":341.0,"stateMnwMhw":"normal","stateNswHsw":"normal"}
+const size_t WATER_MEASUREMENT_CAPACITY = JSON_OBJECT_SIZE(4) + 96;   // keys (40) + timestamp (26) + states
+
+/*
+ * All requests for all stations go out pipelined on one connection, up to MAX_PENDING of them
+ * in flight: per station the station itself (if its names aren't known yet), then each series.
+ */
+typedef struct WaterRequest {
+    uint8_t station;    // index into water_stations[]
+    int8_t series;      // index into water_series[], -1 = the station itself
+} WaterRequest;
+
+const int WATER_REQUEST_MAX = WATER_STATION_COUNT * (1 + WATER_SERIES_COUNT);
+const size_t WATER_PATH_SIZE = 112;     // WATER_STATION_PATH + uuid (36) + longest series path + '\0'
+const size_t WATER_BODY_SIZE = 192;     // a currentmeasurement body is about 100 bytes
+
+/**
+ * @brief Fetch the water data from pegelonline.
+ * 
+ * @param stale SOURCE_BIT()s of the sources to fetch
+ * @return uint8_t SOURCE_BIT()s of the sources fetched successfully
+ */
+uint8_t fetchPegelonline(uint8_t stale)
+{
+    HttpsSession http("www.pegelonline.wsv.de", &tls_sessions[HOST_PEGELONLINE]);
+    uint8_t ok = 0;
+
+    if (getTodaysWater(http)) {
+        ok |= SOURCE_BIT(SOURCE_WATER);
+    }
+    CLOG(myLog1.add(), "pegelonline: %d stations, %lu bytes received", WATER_STATION_COUNT, (unsigned long)http.received);
+
+    http.stop();
+    return ok;
+}
+
+/**
+ * @brief Get the Todays Water of all stations from pegelonline.wsv.de, one currentmeasurement
+ * per series, e.g.
+ * https://www.pegelonline.wsv.de/webservices/rest-api/v2/stations/66ff3eb4-513b-478b-abd2-2f5126ea66fd/W/currentmeasurement.json
+ * Stations that fail keep their previous data. The bodies are small enough to read whole first,
+ * one with the same crc as last time isn't parsed again. (They aren't requested conditionally,
+ * the validators would take more room than the body and a 304 is no shorter.)
+ * 
+ * @param http Session to send the requests on
+ * @return true If we successfully retrieved the water of every station
+ * @return false If we failed to retrieve the water of a station
+ */
+bool getTodaysWater(HttpsSession &http)
+{
+    uint32_t dt = millis();
+    WaterStruct parsed[WATER_STATION_COUNT];
+    bool good[WATER_STATION_COUNT];
+    int last[WATER_STATION_COUNT];    // index of the station's last request
+    WaterRequest requests[WATER_REQUEST_MAX];
+    char paths[HttpsSession::MAX_PENDING][WATER_PATH_SIZE];   // request r is in paths[r % MAX_PENDING] while in flight
+    char body[WATER_BODY_SIZE];
+    int count = 0;
+    int unchanged = 0;
+
+    // A station that failed last time left water[] out of step with its cache crc, the data of
+    // the others is still good, only the body crcs can't be trusted to skip a parse
+    if (!isCacheIntact(SOURCE_WATER)) {
+        for (int s = 0; s < WATER_STATION_COUNT; s++) {
+            memset(water[s].series_crc, 0, sizeof(water[s].series_crc));
+        }
+    }
+
+    for (int s = 0; s < WATER_STATION_COUNT; s++) {
+        parsed[s] = water[s];
+        good[s] = true;
+        if (water[s].station[0] == '\0') {
+            requests[count++] = {(uint8_t)s, -1};
+        }
+        for (int i = 0; i < WATER_SERIES_COUNT; i++) {
+            requests[count++] = {(uint8_t)s, (int8_t)i};
+        }
+        last[s] = count - 1;
+    }
 
-    // Send GET request
-    client.print(String("GET ") + WATER_URL + " HTTP/1.1\r\n" + "Host: " + host + "\r\n" + "Connection: close\r\n\r\n");
-    while (client.connected()) {
-        String line = client.readStringUntil('\n');
-        if (line == "\r") {
-            //Serial.println("Header end found.");
+    int sent = 0;
+    int done = 0;
+    for (; done < count; done++) {
+        while (sent < count && sent - done < HttpsSession::MAX_PENDING) {
+            const WaterRequest &request = requests[sent];
+            char *path = paths[sent % HttpsSession::MAX_PENDING];
+
+            snprintf(path, WATER_PATH_SIZE, WATER_STATION_PATH "%s%s", water_stations[request.station],
+                     request.series < 0 ? ".json?includeTimeseries=true" : water_series[request.series].path);
+            if (!http.send(path)) {
+                break;  // connection lost, response() reconnects for the requests still in flight
+            }
+            sent++;
+        }
+        if (sent == done || !http.response()) {
+            CLOG(myLog1.add(), "HTTPS connection to www.pegelonline.wsv.de failed!");
             break;
         }
 
-        Serial.println(line);
+        const WaterRequest &request = requests[done];
+        WaterStruct &out = parsed[request.station];
+        bool understood = false;
 
-        if ((millis() - timeout) > 5000UL) {
-            //Serial.println("HTTP header timeout");
-            client.stop();
-            return false;
+        if (request.series < 0) {
+            if (http.status == 200) {
+                out = WaterStruct();
+                understood = parseStation(http, out);
+            }
+        } else if (http.status == 404) {    // the station doesn't measure this series
+            out.*water_series[request.series].value = 0;
+            (out.*water_series[request.series].timestamp)[0] = '\0';
+            out.series_crc[request.series] = 0;
+            understood = true;
+        } else if (http.status == 200) {
+            size_t len = 0;
+            int c;
+
+            while (len < sizeof(body) && (c = http.read()) >= 0) {
+                body[len++] = c;
+            }
+            if (http.peek() >= 0) {
+                CLOG(myLog1.add(), "pegelonline measurement longer than %u bytes", (unsigned)sizeof(body));
+            } else if (http.validator.bodyCrc == out.series_crc[request.series]) {
+                understood = true;
+                unchanged++;
+            } else {
+                understood = parseMeasurement(body, len, water_series[request.series], out);
+                out.series_crc[request.series] = understood ? http.validator.bodyCrc : 0;
+            }
+        }
+        if (!understood) {
+            CLOG(myLog1.add(), "HTTPS[1] pegelonline station %d request %d status %d", request.station, request.series, http.status);
+            good[request.station] = false;
         }
     }
 
-    //Serial.print("JSON length: "); Serial.println(client.available());
-    //Serial.println("Parsing JSON...");
+    http.finish();
 
-    // bool decode = false;
-    DynamicJsonDocument doc(20 * 1024);
+    bool retcode = true;
+    for (int s = 0; s < WATER_STATION_COUNT; s++) {
+        if (good[s] && last[s] < done) {
+            water[s] = parsed[s];
+        } else {
+            retcode = false;
+        }
+    }
+    if (retcode) {
+        CLOG(myLog1.add(), "Deserialized today's water in %ld ms, %d of %d measurements unchanged", millis() - dt,
+             unchanged, WATER_STATION_COUNT * WATER_SERIES_COUNT);
+    }
 
-    //Serial.println("Deserialization process starting...");
+    return retcode;
+}
 
-    // Parse JSON object
-    DeserializationError err = deserializeJson(doc, client);
+/**
+ * @brief Parse a pegelonline currentmeasurement response into one series of a WaterStruct.
+ * 
+ * @param json Body of the response
+ * @param len Length of the body
+ * @param series Which members of out the measurement goes to
+ * @param out Filled with the value, timestamp and (if the series has them) states
+ * @return true if the measurement was understood
+ */
+bool parseMeasurement(const char *json, size_t len, const WaterSeries &series, WaterStruct &out) {
+    StaticJsonDocument<WATER_MEASUREMENT_CAPACITY> doc;
+
+    DeserializationError err = deserializeJson(doc, json, len);
     if (err) {
+        CLOG(myLog1.add(), "deserializeJson(water measurement) failed: %s", err.c_str());
+        return false;
+    }
 
-        CLOG(myLog1.add(), "deserializeJson(waterdata) failed: %s", err.c_str());
-        retcode = false;
+    out.*series.value = doc["value"]; // float, e.g. 159.0
+    strlcpy(out.*series.timestamp, doc["timestamp"] | "", sizeof(out.*series.timestamp)); // "2024-09-10T08:30:00+02:00"
+    if (series.stateMnwMhw != NULL) {
+        out.*series.stateMnwMhw = parseWaterState(doc["stateMnwMhw"]); // "normal"
+        out.*series.stateNswHsw = parseWaterState(doc["stateNswHsw"]); // "normal"
     }
-    else {
-        water.station = doc["shortname"].as<String>(); //station name
-        water.height_longname = doc["timeseries"][0]["longname"].as<String>();
-        water.height_unit = doc["timeseries"][0]["unit"].as<String>(); // "cm"
-        water.height = doc["timeseries"][0]["currentMeasurement"]["value"]; // float, e.g. 159.0
-        water.height_timestamp = doc["timeseries"][0]["currentMeasurement"]["timestamp"].as<String>(); // timestamp "2024-09-10T08:30:00+02:00"
-        water.height_stateMnwMhw = doc["timeseries"][0]["currentMeasurement"]["stateMnwMhw"].as<String>(); // "normal"
-        water.height_stateNswHsw = doc["timeseries"][0]["currentMeasurement"]["stateNswHsw"].as<String>(); // "normal"
-        
-        water.temp_longname = doc["timeseries"][1]["longname"].as<String>(); // "WASSERTEMPERATUR"
-        water.temp_unit = doc["timeseries"][1]["unit"].as<String>(); // "°C"
-        water.temp = doc["timeseries"][1]["currentMeasurement"]["value"]; //22.6
-        water.temp_timestamp = doc["timeseries"][1]["currentMeasurement"]["timestamp"].as<String>(); // timestamp "2024-09-10T08:30:00+02:00"
+    return true;
+}
+
+/*
+ * The station JSON is read as a stream: the top level object key by key, values that aren't
+ * needed are skipped as they pass by and each entry of 'timeseries' is deserialized on its own
+ * through the filter below. Memory use is the same however many series the station has, the
+ * series are matched by shortname so their order doesn't matter.
+ */
+const char WATER_SERIES_FILTER[] = R"({"shortname":true,"longname":true,"unit":true,)"
+                                   R"("currentMeasurement":{"value":true,"timestamp":true,"stateMnwMhw":true,"stateNswHsw":true}})";
 
-        water.speed_longname = doc["timeseries"][5]["longname"].as<String>(); // "ABFLUSS"
-        water.speed_unit = doc["timeseries"][5]["unit"].as<String>(); // "m³/s"
-        water.speed = doc["timeseries"][5]["currentMeasurement"]["value"]; //92.0
-        water.speed_timestamp = doc["timeseries"][5]["currentMeasurement"]["timestamp"].as<String>(); // timestamp "2024-09-10T08:30:00+02:00"
+const size_t WATER_SERIES_FILTER_CAPACITY = 2 * JSON_OBJECT_SIZE(4) + 96;  // 8 keys of the filter
+const size_t WATER_SERIES_CAPACITY = 2 * JSON_OBJECT_SIZE(4) + 96 + 112;   // keys + longname (32), unit (8), timestamp (26), states
 
+/**
+ * @brief Parse a pegelonline station (with includeTimeseries, the current measurements are read
+ * too if includeCurrentMeasurement was set) into a WaterStruct. Series the station doesn't have
+ * are left empty.
+ * 
+ * @param in Stream positioned at the start of the station JSON
+ * @param out Filled with the station name and the W (height), WT (temperature) and Q (discharge) series
+ * @return true if the station object was read to its end
+ */
+bool parseStation(Stream &in, WaterStruct &out) {
+    char key[16];
+    int c;
 
-        CLOG(myLog1.add(), "Deserialized today's water in %ld ms", millis() - dt);
+    if (nextJsonChar(in) != '{') {
+        return false;
     }
 
-    client.stop();
+    c = nextJsonChar(in);
+    while (c == '"') {
+        if (!readJsonString(in, key, sizeof(key)) || nextJsonChar(in) != ':') {
+            return false;
+        }
 
-    return retcode;
+        if (strcmp(key, "shortname") == 0) {
+            if (nextJsonChar(in) != '"' || !readJsonString(in, out.station, sizeof(out.station))) {
+                return false;
+            }
+            c = nextJsonChar(in);
+        } else if (strcmp(key, "timeseries") == 0) {
+            if (!parseStationSeries(in, out)) {
+                return false;
+            }
+            c = nextJsonChar(in);
+        } else {
+            c = skipJsonValue(in);
+        }
+
+        if (c != ',') {
+            break;
+        }
+        c = nextJsonChar(in);
+    }
+    return c == '}';
 }
 
 /**
- * @brief Get the Todays Weather from openweathermaps.org
+ * @brief Read the 'timeseries' array of a station, one entry at a time.
  * 
- * @return true If we successfully retrieved the weather
- * @return false If we failed to retrieve the weather
+ * @param in Stream positioned after "timeseries":
+ * @param out Series found are copied into it
+ * @return true if the array was read to its end
  */
-bool getTodaysWeather(void)
-{
-    WiFiClientSecure client;
-    bool retcode = true;
-    int port = 443;
-    const char *host = "api.openweathermap.org";
+bool parseStationSeries(Stream &in, WaterStruct &out) {
+    StaticJsonDocument<WATER_SERIES_FILTER_CAPACITY> filter;
+    StaticJsonDocument<WATER_SERIES_CAPACITY> series;
 
-    uint32_t dt = millis();
+    deserializeJson(filter, WATER_SERIES_FILTER);
 
-    client.setInsecure(); // certificate is not checked
-
-    if (!client.connect(host, port)) {
-        CLOG(myLog1.add(), "HTTPS[1] connection to OpenWeatherMap failed!");
+    if (nextJsonChar(in) != '[') {
         return false;
     }
+    if (peekJsonChar(in) == ']') {
+        in.read();
+        return true;
+    }
 
-    uint32_t timeout = millis();
-    char c = 0;
-
-    // Send GET request
-    client.print(String("GET ") + WEATHER_URL + " HTTP/1.1\r\n" + "Host: " + host + "\r\n" + "Connection: close\r\n\r\n");
-    while (client.connected()) {
-        String line = client.readStringUntil('\n');
-        if (line == "\r") {
-            //Serial.println("Header end found.");
-            break;
+    for (;;) {
+        DeserializationError err = deserializeJson(series, in, DeserializationOption::Filter(filter));
+        if (err) {
+            CLOG(myLog1.add(), "deserializeJson(water series) failed: %s", err.c_str());
+            return false;
         }
 
-        Serial.println(line);
+        const char *name = series["shortname"] | "";
+        JsonVariantConst now = series["currentMeasurement"];
+
+        if (strcmp(name, "W") == 0) {
+            strlcpy(out.height_longname, series["longname"] | "", sizeof(out.height_longname)); // "WASSERSTAND ROHDATEN"
+            strlcpy(out.height_unit, series["unit"] | "", sizeof(out.height_unit)); // "cm"
+            out.height = now["value"]; // float, e.g. 159.0
+            strlcpy(out.height_timestamp, now["timestamp"] | "", sizeof(out.height_timestamp)); // timestamp "2024-09-10T08:30:00+02:00"
+            out.height_stateMnwMhw = parseWaterState(now["stateMnwMhw"]); // "normal"
+            out.height_stateNswHsw = parseWaterState(now["stateNswHsw"]); // "normal"
+        } else if (strcmp(name, "WT") == 0) {
+            strlcpy(out.temp_longname, series["longname"] | "", sizeof(out.temp_longname)); // "WASSERTEMPERATUR"
+            strlcpy(out.temp_unit, series["unit"] | "", sizeof(out.temp_unit)); // "°C"
+            out.temp = now["value"]; //22.6
+            strlcpy(out.temp_timestamp, now["timestamp"] | "", sizeof(out.temp_timestamp));
+        } else if (strcmp(name, "Q") == 0) {
+            strlcpy(out.speed_longname, series["longname"] | "", sizeof(out.speed_longname)); // "ABFLUSS"
+            strlcpy(out.speed_unit, series["unit"] | "", sizeof(out.speed_unit)); // "m³/s"
+            out.speed = now["value"]; //92.0
+            strlcpy(out.speed_timestamp, now["timestamp"] | "", sizeof(out.speed_timestamp));
+        }
 
-        if ((millis() - timeout) > 5000UL) {
-            //Serial.println("HTTP header timeout");
-            client.stop();
+        int c = nextJsonChar(in);
+        if (c == ']') {
+            return true;
+        }
+        if (c != ',') {
             return false;
         }
     }
+}
+
+/**
+ * @brief Read the next character of a JSON stream that isn't whitespace.
+ * 
+ * @param in Stream to read
+ * @return int the character, -1 at the end of the stream
+ */
+int nextJsonChar(Stream &in) {
+    int c;
+
+    do {
+        c = in.read();
+    } while (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+    return c;
+}
+
+/**
+ * @brief Skip whitespace and return the next character of a JSON stream without reading it.
+ * 
+ * @param in Stream to read
+ * @return int the character, -1 at the end of the stream
+ */
+int peekJsonChar(Stream &in) {
+    int c;
+
+    while ((c = in.peek()) == ' ' || c == '\t' || c == '\n' || c == '\r') {
+        in.read();
+    }
+    return c;
+}
+
+/**
+ * @brief Read the rest of a JSON string after its opening quote. Escaped characters are
+ * copied without their backslash, \u escapes are not decoded (pegelonline sends UTF-8).
+ * 
+ * @param in Stream to read
+ * @param out Buffer for the string, truncated to fit, NULL = skip the string
+ * @param size Size of out
+ * @return true if the closing quote was read
+ */
+bool readJsonString(Stream &in, char *out, size_t size) {
+    size_t len = 0;
+    int c;
+
+    while ((c = in.read()) >= 0 && c != '"') {
+        if (c == '\\' && (c = in.read()) < 0) {
+            break;
+        }
+        if (out != NULL && len + 1 < size) {
+            out[len++] = c;
+        }
+    }
+    if (out != NULL && size > 0) {
+        out[len] = '\0';
+    }
+    return c == '"';
+}
+
+/**
+ * @brief Skip a JSON value of any type, including nested objects and arrays.
+ * 
+ * @param in Stream positioned before the value
+ * @return int the first character after the value that isn't whitespace, -1 at the end of the stream
+ */
+int skipJsonValue(Stream &in) {
+    int depth = 0;
+    int c = nextJsonChar(in);
+
+    while (c >= 0) {
+        if (c == '"') {
+            if (!readJsonString(in, NULL, 0)) {
+                return -1;
+            }
+            if (depth == 0) {
+                return nextJsonChar(in);
+            }
+        } else if (c == '{' || c == '[') {
+            depth++;
+        } else if (c == '}' || c == ']') {
+            if (depth == 0) {
+                return c; // a number or literal ended by its container
+            }
+            if (--depth == 0) {
+                return nextJsonChar(in);
+            }
+        } else if (depth == 0 && (c == ',' || c == ' ' || c == '\t' || c == '\n' || c == '\r')) {
+            return c == ',' ? c : nextJsonChar(in); // end of a number or literal
+        }
+        c = in.read();
+    }
+    return -1;
+}
+
+/**
+ * @brief Get the Todays Weather from openweathermaps.org
+ * 
+ * @param http Session the WEATHER_URL request was sent on
+ * @param gunzip Inflates the body if it is gzip encoded
+ * @param known Validators the request was sent with, NULL if the cached weather can't be kept
+ * @return true If we successfully retrieved the weather (or it wasn't modified)
+ * @return false If we failed to retrieve the weather
+ */
+bool getTodaysWeather(HttpsSession &http, GzipStream &gunzip, const HttpValidator *known)
+{
+    bool retcode = true;
+
+    uint32_t dt = millis();
+
+    if (http.response() && http.status == 304 && known != NULL) {
+        CLOG(myLog1.add(), "Today's weather not modified");
+        http.finish();
+        return true;
+    }
+    if (http.status != 200) {   // 0 if there was no response
+        CLOG(myLog1.add(), "HTTPS[1] OpenWeatherMap status %d", http.status);
+        return false;
+    }
 
     //Serial.print("JSON length: "); Serial.println(client.available());
     //Serial.println("Parsing JSON...");
@@ -627,16 +1587,22 @@ bool getTodaysWeather(void)
     //Serial.println("Deserialization process starting...");
 
     // Parse JSON object
-    DeserializationError err = deserializeJson(doc, client);
+    Stream *body = responseBody(http, gunzip);
+    DeserializationError err = body ? deserializeJson(doc, *body) : DeserializationError::InvalidInput;
+    if (!err && http.gzipped && !gunzip.finish()) {
+        err = DeserializationError::InvalidInput;   // the gzip trailer doesn't match what was inflated
+    }
+    http.finish();      // the body crc is complete once all of the body was read
+
     if (err) {
 
         CLOG(myLog1.add(), "deserializeJson(1) failed: %s", err.c_str());
         retcode = false;
     }
     else {
-        weather.main = doc["weather"][0]["main"].as<String>();
-        weather.description = doc["weather"][0]["description"].as<String>();
-        weather.icon = doc["weather"][0]["icon"].as<String>();
+        strlcpy(weather.main, doc["weather"][0]["main"] | "", sizeof(weather.main));
+        strlcpy(weather.description, doc["weather"][0]["description"] | "", sizeof(weather.description));
+        weather.icon = parseWeatherIcon(doc["weather"][0]["icon"]);
         weather.temperature = doc["main"]["temp"];
         weather.high = doc["main"]["temp_max"];
         weather.low = doc["main"]["temp_min"];
@@ -651,255 +1617,599 @@ bool getTodaysWeather(void)
         weather.sunset = doc["sys"]["sunset"];
         weather.visibility = doc["visibility"];
         weather.clouds = doc["clouds"]["all"];
+        cache[SOURCE_WEATHER].validator = http.validator;
 
         CLOG(myLog1.add(), "Deserialized today's weather in %ld ms", millis() - dt);
     }
 
-    client.stop();
-
     return retcode;
 }
 
+/**
+ * @brief The body of the current response as the parser should read it: the session itself, or
+ * the inflated body if the server sent it gzip encoded.
+ * 
+ * @param http Session with the response headers read
+ * @param gunzip Inflates the body if it is gzip encoded
+ * @return Stream* the body, NULL if it claims to be gzip but isn't
+ */
+Stream *responseBody(HttpsSession &http, GzipStream &gunzip)
+{
+    if (!http.gzipped) {
+        return &http;
+    }
+    if (!gunzip.begin(&http)) {
+        CLOG(myLog1.add(), "gzip body not understood");
+        return NULL;
+    }
+    return &gunzip;
+}
+
+/*
+ * Forecast JSON filter, only these fields of each 'list' entry are kept by the parser. The
+ * capacities below are derived from this layout, keep them in step when adding a field.
+ */
+const char FORECAST_FILTER[] = R"({"list":[{"dt":true,"clouds":{"all":true},"wind":{"speed":true,"deg":true},"rain":{"3h":true},"snow":{"3h":true},)"
+                               R"("main":{"temp":true,"feels_like":true,"temp_min":true,"temp_max":true,"pressure":true,"humidity":true},)"
+                               R"("weather":[{"icon":true}]}]})";
+
+// Member/element counts of the filtered layout above
+const int FORECAST_ENTRY_MEMBERS = 7;   // dt, clouds, wind, rain, snow, main, weather
+const int FORECAST_MAIN_MEMBERS = 6;    // temp, feels_like, temp_min, temp_max, pressure, humidity
+const int FORECAST_WEATHER_MEMBERS = 1; // icon
+const int FORECAST_WEATHER_ENTRIES = 2; // usually 1, OWM may add a secondary condition
+const int FORECAST_KEY_CHARS = 160;     // all key names above once (strings are de-duplicated)
+const int FORECAST_VALUE_CHARS = 16;    // icon (4) of each weather entry + nulls
+
+const size_t FORECAST_FILTER_CAPACITY = JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(FORECAST_ENTRY_MEMBERS) +
+                                        JSON_OBJECT_SIZE(FORECAST_MAIN_MEMBERS) + JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(FORECAST_WEATHER_MEMBERS) +
+                                        3 * JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(2) + FORECAST_KEY_CHARS;
+
+const size_t FORECAST_ENTRY_CAPACITY = JSON_OBJECT_SIZE(FORECAST_ENTRY_MEMBERS) + JSON_OBJECT_SIZE(FORECAST_MAIN_MEMBERS) +
+                                       JSON_ARRAY_SIZE(FORECAST_WEATHER_ENTRIES) + FORECAST_WEATHER_ENTRIES * JSON_OBJECT_SIZE(FORECAST_WEATHER_MEMBERS) +
+                                       3 * JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(2) + FORECAST_VALUE_CHARS;
+
+const size_t FORECAST_JSON_CAPACITY = JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(FORECAST_API_COUNT) +
+                                      FORECAST_API_COUNT * FORECAST_ENTRY_CAPACITY + FORECAST_KEY_CHARS;
+
 /**
  * @brief Get the Weather Forecast for the next 'n' readings. Readings are for every 3 hours
  * and the number to retrieve is set in a global variable 'forecast_counter'.
  * 
+ * @param http Session the FORECAST_URL request was sent on
+ * @param gunzip Inflates the body if it is gzip encoded
+ * @param known Validators the request was sent with, NULL if the cached forecast can't be kept
  * @return true 
  * @return false 
  */
-bool getWeatherForecast(void)
+bool getWeatherForecast(HttpsSession &http, GzipStream &gunzip, const HttpValidator *known)
 {
-    WiFiClientSecure client;
     bool retcode = true;
-    int port = 443;
-    const char *host = "api.openweathermap.org";
 
     uint32_t dt = millis();
 
-    client.setInsecure(); // certificate is not checked
-
-    if (!client.connect(host, port)) {
-        CLOG(myLog1.add(), "HTTPS[2] connection to OpenWeatherMap failed!");
-
+    if (http.response() && http.status == 304 && known != NULL) {
+        CLOG(myLog1.add(), "Forecast not modified");
+        http.finish();
+        return true;
+    }
+    if (http.status != 200) {   // 0 if there was no response
+        CLOG(myLog1.add(), "HTTPS[2] OpenWeatherMap status %d", http.status);
         return false;
     }
 
-    uint32_t timeout = millis();
-    char c = 0;
+    //Serial.println("Parsing Forecast JSON...");
 
-    // Send GET request
-    client.print(String("GET ") + FORECAST_URL + " HTTP/1.1\r\n" + "Host: " + host + "\r\n" + "Connection: close\r\n\r\n");
+    // Only the fields listed in the filter are kept, everything else in the payload
+    // (city, sys, visibility, pop...) is skipped by the parser without being stored.
+    StaticJsonDocument<FORECAST_FILTER_CAPACITY> filter;
+    deserializeJson(filter, FORECAST_FILTER);
 
-    while (client.connected()) {
-        String line = client.readStringUntil('\n');
-        if (line == "\r") {
-            //Serial.println("Header end found.");
-            break;
-        }
+    uint32_t heap = ESP.getFreeHeap();
+    DynamicJsonDocument doc(FORECAST_JSON_CAPACITY);
 
-        if ((millis() - timeout) > 5000UL) {
-            //Serial.println("HTTP header timeout");
-            client.stop();
-            return false;
+    //Serial.println("Deserialization process starting...");
+
+    // Parse JSON object
+    Stream *body = responseBody(http, gunzip);
+    DeserializationError err = body ? deserializeJson(doc, *body, DeserializationOption::Filter(filter)) : DeserializationError::InvalidInput;
+    if (!err && http.gzipped && !gunzip.finish()) {
+        err = DeserializationError::InvalidInput;   // the gzip trailer doesn't match what was inflated
+    }
+    http.finish();      // the body crc is complete once all of the body was read
+    CLOG(myLog1.add(), "Forecast JSON %u/%u bytes, heap %u", (unsigned)doc.memoryUsage(), (unsigned)FORECAST_JSON_CAPACITY, heap - ESP.getFreeHeap());
+    if (http.gzipped) {
+        CLOG(myLog1.add(), "Forecast gzip, %u bytes inflated", (unsigned)gunzip.inflated);
+    }
+    if (err) {
+        CLOG(myLog1.add(), "deserializeJson(2) failed: %s", err.c_str());
+
+        retcode = false;
+    }
+    else {
+        JsonArrayConst list = doc["list"];
+        int i = 0;
+
+        // Walk the list once, indexing a JsonArray is a linear search
+        forecast = ForecastStore();
+        for (JsonObjectConst entry : list) {
+            if (i >= forecast_counter) {
+                break;
+            }
+            JsonObjectConst main = entry["main"];
+            forecast.dt[i] = entry["dt"];
+            forecast.temperature[i] = main["temp"];
+            forecast.feels_like[i] = main["feels_like"];
+            forecast.low[i] = main["temp_min"];
+            forecast.high[i] = main["temp_max"];
+            forecast.pressure[i] = main["pressure"];
+            forecast.humidity[i] = main["humidity"];
+            forecast.icon[i] = parseWeatherIcon(entry["weather"][0]["icon"]);
+            forecast.clouds[i] = entry["clouds"]["all"];
+            forecast.wind_speed[i] = entry["wind"]["speed"].as<float>() * 3.6; // convert from m/s to km/h
+            forecast.wind_deg[i] = entry["wind"]["deg"];
+            forecast.rain[i] = entry["rain"]["3h"];
+            forecast.snow[i] = entry["snow"]["3h"];
+            i++;
         }
+        cache[SOURCE_FORECAST].validator = http.validator;
+
+        CLOG(myLog1.add(), "Deserialized [%d] forecasts in %ld ms", forecast_counter, millis() - dt);
     }
 
-    //Serial.println("Parsing Forecast JSON...");
+    return retcode;
+}
 
-    DynamicJsonDocument doc(24 * 1024);
+/**
+ * @brief Set up the display, serial connection, rotation, font, colour, and size.
+ * 
+ */
+void initialiseDisplay() {
+    // After a timer wake the controller still holds the last image, which partial refreshes need
+    bool initial = esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_TIMER;
 
-    //Serial.println("Deserialization process starting...");
+    display.init(115200, initial, 2, false); // USE THIS for Waveshare boards with "clever" reset circuit, 2ms reset pulse
+    display.setRotation(0);
+    display.setFullWindow();
+    display.firstPage();
+    display.hibernate();
+    delay(1000);
+
+    frame.setRotation(0);
+    frame.setTextSize(0);
+    frame.setTextWrap(false);
+    frame.setWidthCache(&text_widths);
+    frame.setFont(&DejaVu_Sans_Bold_11);
+    frame.setTextColor(GxEPD_BLACK);
+}
+
+/**
+ * @brief Display an error message on the display to the user.
+ * 
+ * @param message Message to display
+ */
+void displayErrorMessage(String message) {
+    renderErrorMessage(message);
+    updateDisplay(false);
+}
+
+/**
+ * @brief Draw an error message into the frame buffer.
+ * 
+ * @param message Message to display
+ */
+void renderErrorMessage(String message) {
+    frame.fillScreen(GxEPD_WHITE);
+    frame.setTextColor(GxEPD_BLACK);
+    frame.setCursor(10, 60);
+    drawString(200, 150, "Error: " + message, CENTER);
+}
+
+/**
+ * @brief Display an error message on the display to the user.
+ * 
+ * @param message Message to display
+ */
+void displayWifiErrorMessage(void)
+{
+    battery_voltage = getBatteryVoltage(); 
+    renderWifiErrorMessage();
+    updateDisplay(false);
+}
+
+/**
+ * @brief Draw the wifi error message into the frame buffer.
+ * 
+ */
+void renderWifiErrorMessage(void)
+{
+    frame.fillScreen(GxEPD_WHITE);
+    frame.setTextColor(GxEPD_BLACK);
+    frame.setCursor(10, 60);
+    drawString(200, 60, "Error: Unable to connect to wifi network.", CENTER);
+    frame.setTextColor(GxEPD_RED);
+    drawString(200, 85, SSID, CENTER);
+    frame.setTextColor(GxEPD_BLACK);
+    drawString(30, 130, "a) Check wifi network is on.", LEFT);
+    drawString(30, 150, "b) Reboot display via on/off or reset button.", LEFT);
+    drawString(30, 170, "c) Move display closer to the router.", LEFT);
+    drawString(30, 190, "d) Contact support!", LEFT);
+
+    displayBattery(304, 279);
+}
+
+/**
+ * @brief Set up the display with all of the information we're going to show, e.g. temperature,
+ * forecast, sun rise and set times...
+ * 
+ */
+void displayInformation(void)
+{
+    uint32_t dt = millis();
+
+    #if RENDER_STATS
+    frame.resetCounts();
+    uint32_t render_start = micros();
+    #endif
+
+    renderInformation();
+
+    #if RENDER_STATS
+    reportRenderStats(micros() - render_start);
+    #endif
+
+    updateDisplay(true);
+    water_page = (water_page + 1) % WATER_STATION_COUNT;
+
+    CLOG(myLog1.add(), "Display updated in %ld seconds", (millis() - dt) / 1000);
+}
 
-    // Parse JSON object
-    DeserializationError err = deserializeJson(doc, client);
-    if (err) {
-        CLOG(myLog1.add(), "deserializeJson(2) failed: %s", err.c_str());
+/**
+ * @brief Draw the weather, forecast and water data into the frame buffer.
+ * 
+ */
+void renderInformation(void)
+{
+    frame.fillScreen(GxEPD_WHITE);
+    drawPanelBorders();
 
-        retcode = false;
+    for (int i = 0; i < PANEL_COUNT; i++) {
+        panels[i].widget(panels[i].ax, panels[i].ay);
     }
-    else {
-        for (byte i = 0; i < forecast_counter; i++) {
-            forecast[i].dt = doc["list"][i]["dt"];
-            forecast[i].temperature = doc["list"][i]["main"]["temp"];
-            forecast[i].feels_like = doc["list"][i]["main"]["feels_like"];
-            forecast[i].icon = doc["list"][i]["weather"][0]["icon"].as<String>();
-            forecast[i].main = doc["list"][i]["weather"][0]["main"].as<String>();
-            forecast[i].description = doc["list"][i]["weather"][0]["description"].as<String>();
-            forecast[i].low = doc["list"][i]["main"]["temp_min"];
-            forecast[i].high = doc["list"][i]["main"]["temp_max"];
-            forecast[i].pressure = doc["list"][i]["main"]["pressure"];
-            forecast[i].humidity = doc["list"][i]["main"]["humidity"];
-            forecast[i].clouds = doc["list"][i]["clouds"]["all"];
-            forecast[i].wind_speed = doc["list"][i]["wind"]["speed"];
-            forecast[i].wind_speed *= 3.6; // convert from m/s to km/h
-            forecast[i].wind_deg = doc["list"][i]["wind"]["deg"];
-            forecast[i].rain = doc["list"][i]["rain"]["3h"];
-            forecast[i].snow = doc["list"][i]["snow"]["3h"];
-            forecast[i].period = doc["list"][i]["dt_txt"].as<String>();
+}
+
+/**
+ * @brief Draw the borders of all panels. The edges are collected as horizontal and vertical
+ * spans, overlapping or touching spans on the same line are merged and each is drawn once
+ * as a fast line.
+ * 
+ */
+void drawPanelBorders(void) {
+    typedef struct Span {
+        int16_t line; // y of a horizontal span, x of a vertical one
+        int16_t from;
+        int16_t to;   // inclusive
+    } Span;
+    Span spans[2][PANEL_COUNT * 2]; // horizontal, vertical
+
+    for (int i = 0; i < PANEL_COUNT; i++) {
+        const Panel &p = panels[i];
+        spans[0][i * 2] = {p.y, p.x, (int16_t)(p.x + p.w - 1)};                       // top
+        spans[0][i * 2 + 1] = {(int16_t)(p.y + p.h - 1), p.x, (int16_t)(p.x + p.w - 1)}; // bottom
+        spans[1][i * 2] = {p.x, p.y, (int16_t)(p.y + p.h - 1)};                       // left
+        spans[1][i * 2 + 1] = {(int16_t)(p.x + p.w - 1), p.y, (int16_t)(p.y + p.h - 1)}; // right
+    }
+
+    for (int vertical = 0; vertical < 2; vertical++) {
+        Span *list = spans[vertical];
+        const int count = PANEL_COUNT * 2;
+
+        // Insertion sort by line, then start, the lists are short
+        for (int i = 1; i < count; i++) {
+            Span span = list[i];
+            int j = i - 1;
+            while (j >= 0 && (list[j].line > span.line || (list[j].line == span.line && list[j].from > span.from))) {
+                list[j + 1] = list[j];
+                j--;
+            }
+            list[j + 1] = span;
         }
 
-        CLOG(myLog1.add(), "Deserialized [%d] forecasts in %ld ms", forecast_counter, millis() - dt);
+        for (int i = 0; i < count;) {
+            Span span = list[i++];
+            while (i < count && list[i].line == span.line && list[i].from <= span.to + 1) {
+                span.to = max(span.to, list[i++].to);
+            }
+            if (vertical) {
+                frame.drawFastVLine(span.line, span.from, span.to - span.from + 1, GxEPD_BLACK);
+            } else {
+                frame.drawFastHLine(span.from, span.line, span.to - span.from + 1, GxEPD_BLACK);
+            }
+        }
     }
+}
 
-    client.stop();
+/**
+ * @brief Display the current weather icon, cloud cover and description.
+ * 
+ * @param x Display x coordinates of the large icon
+ * @param y Display y coordinates of the large icon
+ */
+void displayCurrentWeather(int x, int y) {
+    displayWeatherIcon(x, y, weather.icon, large_icon);
+    if (weather.clouds > 0)
+    {
+        displayCloudCover(x + 50, y + 24, weather.clouds);
+    }
+    displayWeatherDescription(x + 66, y + 105); // Description of the weather now
+}
 
-    return retcode;
+/**
+ * @brief Display the current wind direction and speed.
+ * 
+ * @param x Display x coordinates of the compass centre
+ * @param y Display y coordinates of the compass centre
+ */
+void displayCurrentWind(int x, int y) {
+    displayWind(x, y, weather.wind_deg, weather.wind_speed, 40);
 }
 
+#if RENDER_STATS
 /**
- * @brief Set up the display, serial connection, rotation, font, colour, and size.
+ * @brief Print the render time and primitive counts.
  * 
+ * @param render_us Time renderInformation() took
  */
-void initialiseDisplay() {
-    display.init(115200, true, 2, false); // USE THIS for Waveshare boards with "clever" reset circuit, 2ms reset pulse
-    display.setRotation(0);
-    display.setTextSize(0);
-    display.setFont(&DejaVu_Sans_Bold_11);
-    display.setTextColor(GxEPD_BLACK);
-    display.setFullWindow();
-    display.firstPage();
-    display.hibernate();
-    delay(1000);
+void reportRenderStats(uint32_t render_us) {
+    Serial.printf("Render %lu us, %lu primitives: %lu pixels, %lu spans, %lu lines, %lu rects, %lu chars\n",
+                  (unsigned long)render_us, (unsigned long)frame.primitives(), (unsigned long)frame.pixels,
+                  (unsigned long)frame.spans, (unsigned long)frame.lines, (unsigned long)frame.rects, (unsigned long)frame.chars);
+    Serial.printf("Text sizes: %u cached, %u measured\n", text_widths.hits, text_widths.misses);
 }
+#endif
 
+#if RENDER_FIXTURE
 /**
- * @brief Display an error message on the display to the user.
+ * @brief Fill weather, forecast, water and the time buffers with fixed sample data, so
+ * renders can be profiled and compared without a network.
  * 
- * @param message Message to display
  */
-void displayErrorMessage(String message) {
-    display.setFullWindow();
-    display.firstPage();
+void loadRenderFixture(void) {
+    static const weather_icon icons[] = {ICON_CLEAR_DAY, ICON_FEW_CLOUDS_DAY, ICON_RAIN_DAY, ICON_SNOW_NIGHT, ICON_THUNDERSTORM_DAY, ICON_MIST_NIGHT};
+    const uint32_t start = 1726000000; // 2024-09-10 20:26 UTC
+
+    weather = WeatherStruct();
+    strlcpy(weather.main, "Clouds", sizeof(weather.main));
+    strlcpy(weather.description, "broken clouds", sizeof(weather.description));
+    weather.icon = ICON_BROKEN_DAY;
+    weather.temperature = 17.4;
+    weather.high = 19.2;
+    weather.low = -3.8;
+    weather.feels_like = 16.9;
+    weather.pressure = 1013;
+    weather.humidity = 72;
+    weather.wind_speed = 14.4;
+    weather.wind_deg = 235;
+    weather.wind_gust = 22.1;
+    weather.sunrise = start - 13 * 3600;
+    weather.sunset = start - 30 * 60;
+    weather.visibility = 10000;
+    weather.clouds = 64;
+
+    forecast = ForecastStore();
+    for (int i = 0; i < forecast_counter; i++) {
+        forecast.dt[i] = start + i * 3 * 3600;
+        forecast.icon[i] = icons[i % (sizeof(icons) / sizeof(icons[0]))];
+        forecast.temperature[i] = 12 - i * 1.5;
+        forecast.pressure[i] = 1005 + (i * 7) % 16;
+        forecast.humidity[i] = 60 + i;
+        forecast.clouds[i] = (i * 17) % 100;
+        forecast.wind_speed[i] = 5 + i;
+        forecast.wind_deg[i] = (i * 45) % 360;
+        forecast.rain[i] = (i % 3) * 1.2;
+        forecast.snow[i] = (i % 5 == 4) ? 0.8 : 0;
+    }
+
+    water[0] = WaterStruct();
+    strlcpy(water[0].station, "KONSTANZ", sizeof(water[0].station));
+    strlcpy(water[0].height_longname, "WASSERSTAND ROHDATEN", sizeof(water[0].height_longname));
+    strlcpy(water[0].height_unit, "cm", sizeof(water[0].height_unit));
+    water[0].height = 341;
+    strlcpy(water[0].height_timestamp, "2024-09-10T22:15:00+02:00", sizeof(water[0].height_timestamp));
+    water[0].height_stateMnwMhw = WATER_STATE_NORMAL;
+    water[0].height_stateNswHsw = WATER_STATE_NORMAL;
+    strlcpy(water[0].temp_longname, "WASSERTEMPERATUR", sizeof(water[0].temp_longname));
+    strlcpy(water[0].temp_unit, "°C", sizeof(water[0].temp_unit));
+    water[0].temp = 19.6;
+    strlcpy(water[0].temp_timestamp, "2024-09-10T22:00:00+02:00", sizeof(water[0].temp_timestamp));
+    strlcpy(water[0].speed_longname, "ABFLUSS", sizeof(water[0].speed_longname));
+    strlcpy(water[0].speed_unit, "m³/s", sizeof(water[0].speed_unit));
+    water[0].speed = 92;
+    strlcpy(water[0].speed_timestamp, "2024-09-10T22:15:00+02:00", sizeof(water[0].speed_timestamp));
+    for (int i = 1; i < WATER_STATION_COUNT; i++) {
+        water[i] = water[0];
+    }
+
+    strlcpy(timeStringBuff, "22:26", sizeof(timeStringBuff));
+    strlcpy(dateStringBuff, "10", sizeof(dateStringBuff));
+    strlcpy(dayStringBuff, "Tuesday", sizeof(dayStringBuff));
+    strlcpy(ipAddress, "192.168.1.42", sizeof(ipAddress));
+    rssi = -67;
+    battery_voltage = 3900;
+}
 
-    do {
-        display.fillScreen(GxEPD_WHITE);
-        display.setTextColor(GxEPD_BLACK);
-        display.setCursor(10, 60);
-        drawString(200, 150, "Error: " + message, CENTER);
-    } while (display.nextPage());
+const int WIND_SECTORS = 16;
+static_assert(ICON_COUNT + WIND_SECTORS + 8 <= RENDER_CASE_MAX, "render check matrix doesn't fit RENDER_CASE_MAX");
 
-    display.hibernate();
+/**
+ * @brief Build the render check matrix (see renderFixture.h): the fixture, every icon,
+ * frost, every wind sector, an empty and a full battery and both error screens.
+ * 
+ * @param cases Array to fill, at least RENDER_CASE_MAX entries
+ * @return int Number of cases
+ */
+int buildRenderCases(RenderCase *cases) {
+    int n = 0;
+
+    cases[n++] = {CASE_INFO, 0};
+    cases[n++] = {CASE_ICON, ICON_NONE};
+    for (int icon = ICON_CLEAR_DAY; icon < ICON_COUNT; icon++) {
+        cases[n++] = {CASE_ICON, (int16_t)icon};
+    }
+    cases[n++] = {CASE_COLD, 0};
+    for (int sector = 0; sector < WIND_SECTORS; sector++) {
+        cases[n++] = {CASE_WIND, (int16_t)(sector * 360 / WIND_SECTORS)};
+    }
+    cases[n++] = {CASE_BATTERY, 3000};
+    cases[n++] = {CASE_BATTERY, 4200};
+    cases[n++] = {CASE_ERROR, 0};
+    cases[n++] = {CASE_WIFI_ERROR, 3000};
+    cases[n++] = {CASE_WIFI_ERROR, 4200};
+    return n;
 }
 
 /**
- * @brief Display an error message on the display to the user.
+ * @brief Render a single case of the check matrix into the frame, as the display...()
+ * function of the case does before it sends the frame to the panel.
  * 
- * @param message Message to display
+ * @param c Case to render
+ * @return RenderResult The frame, primitives and time of the render
  */
-void displayWifiErrorMessage(void)
-{
-    display.setFullWindow();
-    display.firstPage();
-
-    do
-    {
-        display.fillScreen(GxEPD_WHITE);
-        display.setTextColor(GxEPD_BLACK);
-        display.setCursor(10, 60);
-        drawString(200, 60, "Error: Unable to connect to wifi network.", CENTER);
-        display.setTextColor(GxEPD_RED);
-        drawString(200, 85, SSID, CENTER);
-        display.setTextColor(GxEPD_BLACK);
-        drawString(30, 130, "a) Check wifi network is on.", LEFT);
-        drawString(30, 150, "b) Reboot display via on/off or reset button.", LEFT);
-        drawString(30, 170, "c) Move display closer to the router.", LEFT);
-        drawString(30, 190, "d) Contact support!", LEFT);
-
-        battery_voltage = getBatteryVoltage(); 
-        displayBattery(304, 279);
-    } while (display.nextPage());
-
-    display.hibernate();
+RenderResult renderCase(const RenderCase &c) {
+    RenderResult result;
+
+    loadRenderFixture();
+    switch (c.kind) {
+    case CASE_ICON:
+        weather.icon = (weather_icon)c.value;
+        break;
+    case CASE_COLD:
+        weather.temperature = -12.3;
+        weather.high = -8.1;
+        weather.low = -17.6;
+        weather.feels_like = -19.4;
+        for (int i = 0; i < forecast_counter; i++) {
+            forecast.temperature[i] = -4 - i * 1.5;
+        }
+        break;
+    case CASE_WIND:
+        weather.wind_deg = c.value;
+        break;
+    case CASE_BATTERY:
+    case CASE_WIFI_ERROR:
+        battery_voltage = c.value;
+        break;
+    default:
+        break;
+    }
+
+    frame.resetCounts();
+    uint32_t start = micros();
+    if (c.kind == CASE_ERROR) {
+        renderErrorMessage("Unable to retrieve data, contact support!");
+    } else if (c.kind == CASE_WIFI_ERROR) {
+        renderWifiErrorMessage();
+    } else {
+        renderInformation();
+    }
+    result.us = micros() - start;
+    result.primitives = frame.primitives();
+    result.frame = frame.getBuffer();
+    return result;
 }
+#endif
 
 /**
- * @brief Set up the display with all of the information we're going to show, e.g. temperature,
- * forecast, sun rise and set times...
+ * @brief Send the rendered frame to the e-paper panel. The panel refresh is skipped when
+ * the frame is identical to the one already on screen, the crc of the last frame shown
+ * is kept in RTC memory across deep sleep.
  * 
+ * @param partial_allowed The frame uses the panels layout and may be sent as partial
+ * updates of the boxes that changed
  */
-void displayInformation(void)
-{
-    uint32_t dt = millis();
+void updateDisplay(bool partial_allowed) {
+    uint32_t crc = crc32_le(0, frame.getBuffer(), FRAME_BYTES);
+    uint32_t crcs[PANEL_COUNT];
+    bool boxes_known = false;
+    int changed = 0;
+
+    if (crc == frame_crc) {
+        skipped_refreshes++;
+        CLOG(myLog1.add(), "Frame unchanged, refresh skipped (%lu)", (unsigned long)skipped_refreshes);
+        return;
+    }
 
-    display.setFullWindow();
-    display.firstPage();
-//    do {
-        display.fillScreen(GxEPD_WHITE);
-
-        // draw box lines
-        // top
-        display.drawLine(0, 0, 145, 0, GxEPD_BLACK);
-        display.drawLine(147, 0, 276, 0, GxEPD_BLACK);
-        display.drawLine(278, 0, 399, 0, GxEPD_BLACK);
-
-        // right
-        display.drawLine(399, 0, 399, 150, GxEPD_BLACK);
-        display.drawLine(399, 152, 399, 180, GxEPD_BLACK);
-        display.drawLine(399, 182, 399, 299, GxEPD_BLACK);
-
-        // bottom
-        display.drawLine(0, 299, 262, 299, GxEPD_BLACK);
-        display.drawLine(264, 299, 399, 299, GxEPD_BLACK);
-
-        // left
-        display.drawLine(0, 0, 0, 150, GxEPD_BLACK);
-        display.drawLine(0, 152, 0, 180, GxEPD_BLACK);
-        display.drawLine(0, 182, 0, 299, GxEPD_BLACK);
-
-        // lines between temp/icon/wind
-        display.drawLine(145, 0, 145, 109, GxEPD_BLACK);
-        display.drawLine(147, 0, 147, 109, GxEPD_BLACK); // temperature, right | -> could be 121
-        display.drawLine(276, 0, 276, 109, GxEPD_BLACK); //weather icon, right |
-        display.drawLine(278, 0, 278, 109, GxEPD_BLACK);
-
-        // line after the two graphs
-        display.drawLine(262, 188, 262, 299, GxEPD_BLACK);
-        display.drawLine(264, 188, 264, 299, GxEPD_BLACK);
-
-        // top middle lines
-        display.drawLine(0, 110, 145, 110, GxEPD_BLACK); //x=125
-        display.drawLine(147, 110, 399, 110, GxEPD_BLACK); //x=125
-        display.drawLine(0, 112, 119, 112, GxEPD_BLACK); //x=125
-        display.drawLine(121, 112, 399, 112, GxEPD_BLACK); //x=125
-
-        // lines between sun and forecasts
-        display.drawLine(119, 112, 119, 186, GxEPD_BLACK);
-        display.drawLine(121, 112, 121, 186, GxEPD_BLACK);
-        
-        // bottom middle lines
-        //display.drawLine(0, 180, 119, 180, GxEPD_BLACK);  // x=125
-        display.drawLine(0, 186, 119, 186, GxEPD_BLACK);  // x=125
-        display.drawLine(121, 186, 399, 186, GxEPD_BLACK);  // x=125
-
-        display.drawLine(0, 188, 262, 188, GxEPD_BLACK);  // x=125
-        display.drawLine(264, 188, 399, 188, GxEPD_BLACK);  // x=125
-
-        // between WATER and GRAPH 2 | Daniel
-        display.drawLine(119, 188, 119, 299, GxEPD_BLACK);
-        display.drawLine(121, 188, 121, 299, GxEPD_BLACK);
-
-        
-
-        displayTemperature(0, 0);
-        displayWeatherIcon(146, -13, weather.icon, large_icon); // Weather icon
-        if (weather.clouds > 0)
-        {
-            displayCloudCover(196, 11, weather.clouds);
+    for (int i = 0; i < PANEL_COUNT; i++) {
+        crcs[i] = boxCrc(panels[i]);
+        boxes_known = boxes_known || box_crc[i] != 0;
+        changed += crcs[i] != box_crc[i];
+    }
+
+    // The frame changed outside all boxes when none of them did, only a full refresh shows that
+    if (!partial_allowed || !boxes_known || changed == 0 || partial_refreshes >= FULL_REFRESH_INTERVAL) {
+        display.epd2.writeImage(frame.getBuffer(), 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+        display.epd2.refresh(false);
+        if (display.epd2.hasFastPartialUpdate) {
+            display.epd2.writeImageAgain(frame.getBuffer(), 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT); // previous image for differential updates
+        }
+        partial_refreshes = 0;
+        CLOG(myLog1.add(), "Full refresh");
+    } else {
+        // Write the changed boxes, then refresh the area covering all of them in one go
+        int16_t x1 = SCREEN_WIDTH, y1 = SCREEN_HEIGHT, x2 = 0, y2 = 0;
+
+        for (int i = 0; i < PANEL_COUNT; i++) {
+            if (crcs[i] == box_crc[i]) {
+                continue;
+            }
+            const Panel &box = panels[i];
+            display.epd2.writeImagePart(frame.getBuffer(), box.x, box.y, SCREEN_WIDTH, SCREEN_HEIGHT, box.x, box.y, box.w, box.h);
+            x1 = min(x1, box.x);
+            y1 = min(y1, box.y);
+            x2 = max(x2, (int16_t)(box.x + box.w));
+            y2 = max(y2, (int16_t)(box.y + box.h));
+        }
+
+        display.epd2.refresh(x1, y1, x2 - x1, y2 - y1);
+
+        for (int i = 0; i < PANEL_COUNT; i++) {
+            if (crcs[i] != box_crc[i]) {
+                const Panel &box = panels[i];
+                display.epd2.writeImagePartAgain(frame.getBuffer(), box.x, box.y, SCREEN_WIDTH, SCREEN_HEIGHT, box.x, box.y, box.w, box.h);
+            }
         }
-        displayWeatherDescription(212, 92);                     // Description of the weather now
-        displayWind(325, 39, weather.wind_deg, weather.wind_speed, 40); // Wind direction info
-        displaySystemInfo(295, 185);
-        displaySunAndMoon(2, 114); // Sunset and sunrise and moon state with icons
-        displayWeatherForecast(118, 115);                               // Forecast
-        displayWater(0, 0); 
-
-//    } while (display.nextPage());
-    display.display(false);  // works instead of do:while loop
+        partial_refreshes++;
+        CLOG(myLog1.add(), "Partial refresh of %d boxes", changed);
+    }
     delay(500);
-    
+
     display.hibernate();
+    frame_crc = crc;
 
-    CLOG(myLog1.add(), "Display updated in %ld seconds", (millis() - dt) / 1000);
+    // Screens that don't use the box layout leave the boxes unknown, forcing a full refresh next time
+    for (int i = 0; i < PANEL_COUNT; i++) {
+        box_crc[i] = partial_allowed ? crcs[i] : 0;
+    }
+}
+
+/**
+ * @brief crc of the part of the frame buffer covered by a box. The box is widened to
+ * whole bytes, the unit the panel is written in.
+ * 
+ * @param box Box to check
+ * @return uint32_t crc32 of the box rows
+ */
+uint32_t boxCrc(const Panel &box) {
+    const uint8_t *buffer = frame.getBuffer();
+    const int line_bytes = (SCREEN_WIDTH + 7) / 8;
+    int first = box.x / 8;
+    int last = (box.x + box.w - 1) / 8;
+    uint32_t crc = 0;
+
+    for (int y = box.y; y < box.y + box.h; y++) {
+        crc = crc32_le(crc, buffer + y * line_bytes + first, last - first + 1);
+    }
+    return crc;
 }
 
 /**
@@ -913,13 +2223,13 @@ void displaySystemInfo(int x, int y) {
     int wifi_rssi = 0;
     int xpos = 1;
     
-    display.setTextColor(GxEPD_BLACK);
-    display.setTextSize(0);
+    frame.setTextColor(GxEPD_BLACK);
+    frame.setTextSize(0);
 
-    display.setFont(&OpenSans_Regular18pt7b);
+    frame.setFont(&OpenSans_Regular18pt7b);
     drawString(x + 95, y + 5, dateStringBuff, RIGHT);
 
-    display.setFont(&DejaVu_Sans_Bold_11);
+    frame.setFont(&DejaVu_Sans_Bold_11);
 
     drawString(x - 26, y + 5, dayStringBuff, LEFT);
     
@@ -940,12 +2250,14 @@ void displaySystemInfo(int x, int y) {
             wifi_rssi = 8; //  -80dbm to  -61dbm displays 2-bars
         if (_rssi <= -100)
             wifi_rssi = 4; // -100dbm to  -81dbm displays 1-bar
-        display.fillRect(rssi_x + xpos * 5 + 60, rssi_y - wifi_rssi, 4, wifi_rssi, GxEPD_BLACK);
+        frame.fillRect(rssi_x + xpos * 5 + 60, rssi_y - wifi_rssi, 4, wifi_rssi, GxEPD_BLACK);
         xpos++;
     }
 
-    display.fillRect(rssi_x + 60, rssi_y - 1, 4, 1, GxEPD_BLACK);
-    drawString(rssi_x, rssi_y - 9, String(rssi) + "dBm", LEFT);
+    frame.fillRect(rssi_x + 60, rssi_y - 1, 4, 1, GxEPD_BLACK);
+    char text[12];
+    snprintf(text, sizeof(text), "%ddBm", rssi);
+    drawString(rssi_x, rssi_y - 9, text, LEFT);
 
     drawString(x + 37, y + 80, ipAddress, CENTER);
 
@@ -961,33 +2273,33 @@ void displaySystemInfo(int x, int y) {
 void displayTemperature(int x, int y) {
      int x_offset = 8;
 
-    display.setFont(&DSEG7_Classic_Bold_21);
-    display.setTextSize(2);
+    frame.setFont(&DSEG7_Classic_Bold_21);
+    frame.setTextSize(2);
     
     // Center the tempearature in the weather box area
     if (weather.temperature < 0)
     {
         drawString(x + x_offset, y + 61, "-", LEFT);                                       // Show temperature sign to compensate for non-proportional font spacing
         drawString(x + x_offset + 25, y + 25, String(fabs(weather.temperature), 1), LEFT); // Show current Temperature without a '-' minus sign
-        display.setTextSize(1);
+        frame.setTextSize(1);
         drawString(x + x_offset + 95, y + 25, "'C", LEFT); // Add-in ° symbol ' in this font plus units
     }
     else if (weather.temperature < 10)
     {
         drawString(x + x_offset + 25, y + 25, String(fabs(weather.temperature), 1), LEFT); // Show current Temperature without a '-' minus sign
-        display.setTextSize(1);
+        frame.setTextSize(1);
         drawString(x + x_offset + 95, y + 25, "'C", LEFT); // Add-in ° symbol ' in this font plus units
     }
     else if (weather.temperature < 20)
     {
         drawString(x, y + 25, String(fabs(weather.temperature), 1), LEFT); // Show current Temperature without a '-' minus sign
-        display.setTextSize(1);
+        frame.setTextSize(1);
         drawString(x + 105, y + 25, "'C", LEFT); // Add-in ° symbol ' in this font plus units
     }
     else
     {
         drawString(x + x_offset + 5, y + 25, String(fabs(weather.temperature), 1), LEFT); // Show current Temperature without a '-' minus sign
-        display.setTextSize(1);
+        frame.setTextSize(1);
         drawString(x + x_offset + 110, y + 25, "'C", LEFT); // Add-in ° symbol ' in this font plus units
     }
 
@@ -999,7 +2311,7 @@ void displayTemperature(int x, int y) {
         drawString(x + 70, y + 82, buffer, CENTER); // Show forecast high and Low, in the font ' is a °
     }
 
-    display.setFont(&DejaVu_Sans_Bold_11);
+    frame.setFont(&DejaVu_Sans_Bold_11);
 
     drawString(x + 73, y + 4, String(weather.humidity) + "% RH", CENTER);
 }
@@ -1015,42 +2327,43 @@ void displayWater(int x, int y) {
     // orientieren an drawGraph(20, 209, 96, 75, temperature, feels_like, forecast_counter, "Temp & Feels"); //x = 155
     int x_offset = -int(x/2); // because font size change from (2) to (1)
     int y_offset = 189;
+    const WaterStruct &w = water[water_page % WATER_STATION_COUNT];
     y += y_offset;
 
-    display.setFont(&DSEG7_Classic_Bold_21);
-    display.setTextSize(1);
+    frame.setFont(&DSEG7_Classic_Bold_21);
+    frame.setTextSize(1);
     
     // Center the tempearature in the weather box area
-    if (water.temp < 0)
+    if (w.temp < 0)
     {
         drawString(x + x_offset, y + 61, "-", LEFT);                             // Show temperature sign to compensate for non-proportional font spacing
-        drawString(x + x_offset + 25, y + 25, String(fabs(water.temp), 1), LEFT); // Show current Temperature without a '-' minus sign
-        display.setTextSize(1);
+        drawString(x + x_offset + 25, y + 25, String(fabs(w.temp), 1), LEFT); // Show current Temperature without a '-' minus sign
+        frame.setTextSize(1);
         drawString(x + x_offset + 95, y + 25, "'C", LEFT); // Add-in ° symbol ' in this font plus units
     }
-    else if (water.temp < 10)
+    else if (w.temp < 10)
     {
-        drawString(x + x_offset + 25, y + 25, String(fabs(water.temp), 1), LEFT); // Show current Temperature without a '-' minus sign
-        display.setTextSize(1);
+        drawString(x + x_offset + 25, y + 25, String(fabs(w.temp), 1), LEFT); // Show current Temperature without a '-' minus sign
+        frame.setTextSize(1);
         drawString(x + x_offset + 95, y + 25, "'C", LEFT); // Add-in ° symbol ' in this font plus units
     }
-    else if (water.temp < 20)
+    else if (w.temp < 20)
     {
-        drawString(x, y + 25, String(fabs(water.temp), 1), LEFT); // Show current Temperature without a '-' minus sign
-        display.setTextSize(1);
+        drawString(x, y + 25, String(fabs(w.temp), 1), LEFT); // Show current Temperature without a '-' minus sign
+        frame.setTextSize(1);
         drawString(x + 105, y + 25, "'C", LEFT); // Add-in ° symbol ' in this font plus units
     }
     else
     {
-        drawString(x + x_offset + 25, y + 25, String(fabs(water.temp), 1), LEFT); // Show current Temperature without a '-' minus sign
-        display.setTextSize(1);
+        drawString(x + x_offset + 25, y + 25, String(fabs(w.temp), 1), LEFT); // Show current Temperature without a '-' minus sign
+        frame.setTextSize(1);
         drawString(x + x_offset  + 25 + 114/2, y + 25, "'C", LEFT); // Add-in ° symbol ' in this font plus units
     }
     
     
 
     /*
-    if (water.low >= 10 && water.low < 20) {
+    if (w.low >= 10 && w.low < 20) {
         drawString(x + 65, y + 82, buffer, CENTER); // Show forecast high and Low, in the font ' is a °
     } else {
         drawString(x + 70, y + 82, buffer, CENTER); // Show forecast high and Low, in the font ' is a °
@@ -1058,12 +2371,12 @@ void displayWater(int x, int y) {
     */
     
 
-    display.setFont(&DejaVu_Sans_Bold_11);
+    frame.setFont(&DejaVu_Sans_Bold_11);
 
-    drawString(x + 62, y + 4, "Water Stats", CENTER);
+    drawString(x + 62, y + 4, WATER_STATION_COUNT > 1 ? w.station : "Water Stats", CENTER);
 
-    drawString(x + x_offset + 5, y + 58, "Level: " + String(int(water.height)) + " cm", LEFT);
-    drawString(x + x_offset + 5, y + 72, "Flow: " +String(water.speed, 0) +" m3", LEFT); // Show water stats in the font ' is a °
+    drawString(x + x_offset + 5, y + 58, "Level: " + String(int(w.height)) + " cm", LEFT);
+    drawString(x + x_offset + 5, y + 72, "Flow: " +String(w.speed, 0) +" m3", LEFT); // Show water stats in the font ' is a °
 }
 
 
@@ -1088,7 +2401,7 @@ void displayWeatherDescription(int x, int y) {
 //     int wifi_rssi = 0;
 //     int xpos = 1;
 
-//     display.drawRect(x, y, 135, 62, GxEPD_BLACK);
+//     frame.drawRect(x, y, 135, 62, GxEPD_BLACK);
 
 //     int rssi_x = x + 33;
 //     int rssi_y = y + 38;
@@ -1103,11 +2416,11 @@ void displayWeatherDescription(int x, int y) {
 //             wifi_rssi = 8; //  -80dbm to  -61dbm displays 2-bars
 //         if (_rssi <= -100)
 //             wifi_rssi = 4; // -100dbm to  -81dbm displays 1-bar
-//         display.fillRect(rssi_x + xpos * 5 + 60, rssi_y - wifi_rssi, 4, wifi_rssi, GxEPD_BLACK);
+//         frame.fillRect(rssi_x + xpos * 5 + 60, rssi_y - wifi_rssi, 4, wifi_rssi, GxEPD_BLACK);
 //         xpos++;
 //     }
 
-//     display.fillRect(rssi_x + 60, rssi_y - 1, 4, 1, GxEPD_BLACK);
+//     frame.fillRect(rssi_x + 60, rssi_y - 1, 4, 1, GxEPD_BLACK);
 //     drawString(rssi_x, rssi_y - 9, String(rssi) + "dBm", LEFT);
 
 //     drawString(x + 68, y + 45, WiFi.localIP().toString(), CENTER);
@@ -1133,14 +2446,14 @@ void displayBattery(int x, int y) {
         CLOG(myLog1.add(), "Battery voltage: %.2f, percentage: %d", bv, percentage);
 
         int offset = 6;
-        display.drawRect(x + 9 + offset, y + 5, 34, 10, GxEPD_BLACK);
-        display.fillRect(x + 43 + offset, y + 7, 2, 6, GxEPD_BLACK);
+        frame.drawRect(x + 9 + offset, y + 5, 34, 10, GxEPD_BLACK);
+        frame.fillRect(x + 43 + offset, y + 7, 2, 6, GxEPD_BLACK);
 
         if (bv <= LOW_BATTERY_VOLTAGE || percentage < 10) {
-            display.setTextColor(GxEPD_RED);
-            display.fillRect(x + 11 + offset, y + 7, 31 * percentage / 100.0, 6, GxEPD_RED);
+            frame.setTextColor(GxEPD_RED);
+            frame.fillRect(x + 11 + offset, y + 7, 31 * percentage / 100.0, 6, GxEPD_RED);
         } else {
-            display.fillRect(x + 11 + offset, y + 7, 31 * percentage / 100.0, 6, GxEPD_BLACK);
+            frame.fillRect(x + 11 + offset, y + 7, 31 * percentage / 100.0, 6, GxEPD_BLACK);
         }
 
         // draw lines to give a better battery icon
@@ -1148,21 +2461,24 @@ void displayBattery(int x, int y) {
         // 50% = 15
         // 75% = 23
         // 100% = 
-        display.fillRect((x + 11 + offset) + 7, y + 6, 1, 8, GxEPD_WHITE);  // 25% across
-        display.fillRect((x + 11 + offset) + 15, y + 6, 1, 8, GxEPD_WHITE);  // 50% across
-        display.fillRect((x + 11 + offset) + 23, y + 6, 1, 8, GxEPD_WHITE);  // 75% across
-        display.fillRect((x + 11 + offset) + 30, y + 6, 1, 8, GxEPD_WHITE);  // 100% across
-
-        // display.setTextColor(colour);
-        drawString(x + 55, y + 6, String(percentage) + "%", LEFT);
-        drawString(x - 29, y + 6,  String(bv, 2) + "v", LEFT);
+        frame.fillRect((x + 11 + offset) + 7, y + 6, 1, 8, GxEPD_WHITE);  // 25% across
+        frame.fillRect((x + 11 + offset) + 15, y + 6, 1, 8, GxEPD_WHITE);  // 50% across
+        frame.fillRect((x + 11 + offset) + 23, y + 6, 1, 8, GxEPD_WHITE);  // 75% across
+        frame.fillRect((x + 11 + offset) + 30, y + 6, 1, 8, GxEPD_WHITE);  // 100% across
+
+        // frame.setTextColor(colour);
+        char text[12];
+        snprintf(text, sizeof(text), "%d%%", percentage);
+        drawString(x + 55, y + 6, text, LEFT);
+        snprintf(text, sizeof(text), "%.2fv", bv);
+        drawString(x - 29, y + 6, text, LEFT);
     } 
     else
     {
         CLOG(myLog1.add(), "Battery voltage: %.2f, recharge now!", bv);
-        display.setTextColor(GxEPD_RED);
+        frame.setTextColor(GxEPD_RED);
         drawString(x + 4, y - 1, "Recharge Battery", LEFT);
-        display.setTextColor(GxEPD_BLACK);
+        frame.setTextColor(GxEPD_BLACK);
     }
 }
 
@@ -1215,36 +2531,36 @@ void displayWind(int x, int y, float angle, float windspeed, int radius) {
     int dyi;
     float kmh;
 
-    arrow(x + offset, y + offset, radius - 11, angle, 15, 22, GxEPD_RED); // Show wind direction on outer circle of width and length
-    display.setTextSize(0);
+    arrow(x + offset, y + offset, radius - 11, lroundf(angle), 15, 22, GxEPD_RED); // Show wind direction on outer circle of width and length
+    frame.setTextSize(0);
 
-    display.drawCircle(x + offset, y + offset, radius, GxEPD_BLACK);       // Draw compass circle
-    display.drawCircle(x + offset, y + offset, radius + 1, GxEPD_BLACK);   // Draw compass circle
-    display.drawCircle(x + offset, y + offset, radius * 0.7, GxEPD_BLACK); // Draw compass inner circle
-    for (float a = 0; a < 360; a = a + 22.5) {
-        dxo = radius * cos((a - 90) * PI / 180);
-        dyo = radius * sin((a - 90) * PI / 180);
-        if (a == 45)
+    frame.drawCircle(x + offset, y + offset, radius, GxEPD_BLACK);       // Draw compass circle
+    frame.drawCircle(x + offset, y + offset, radius + 1, GxEPD_BLACK);   // Draw compass circle
+    frame.drawCircle(x + offset, y + offset, radius * 0.7, GxEPD_BLACK); // Draw compass inner circle
+    for (int point = 0; point < 16; point++) {
+        dxo = trigMul(radius, compassSin(point));
+        dyo = -trigMul(radius, compassCos(point));
+        if (point == 2)
             drawString(dxo + x + 10 + offset, dyo + y - 10 + offset, "NE", CENTER);
-        if (a == 135)
+        if (point == 6)
             drawString(dxo + x + 12 + offset, dyo + y + offset, "SE", CENTER);
-        if (a == 225)
+        if (point == 10)
             drawString(dxo + x - 16 + offset, dyo + y + offset, "SW", CENTER);
-        if (a == 315)
+        if (point == 14)
             drawString(dxo + x - 12 + offset, dyo + y - 10 + offset, "NW", CENTER);
-        dxi = dxo * 0.9;
-        dyi = dyo * 0.9;
-        display.drawLine(dxo + x + offset, dyo + y + offset, dxi + x + offset, dyi + y + offset, GxEPD_BLACK);
-        dxo = dxo * 0.7;
-        dyo = dyo * 0.7;
-        dxi = dxo * 0.9;
-        dyi = dyo * 0.9;
-        display.drawLine(dxo + x + offset, dyo + y + offset, dxi + x + offset, dyi + y + offset, GxEPD_BLACK);
+        dxi = dxo * 9 / 10;
+        dyi = dyo * 9 / 10;
+        frame.drawLine(dxo + x + offset, dyo + y + offset, dxi + x + offset, dyi + y + offset, GxEPD_BLACK);
+        dxo = dxo * 7 / 10;
+        dyo = dyo * 7 / 10;
+        dxi = dxo * 9 / 10;
+        dyi = dyo * 9 / 10;
+        frame.drawLine(dxo + x + offset, dyo + y + offset, dxi + x + offset, dyi + y + offset, GxEPD_BLACK);
     }
 
-    display.setTextColor(GxEPD_RED);
+    frame.setTextColor(GxEPD_RED);
     drawString(x + offset, y - radius - 11 + offset, "N", CENTER);
-    display.setTextColor(GxEPD_BLACK);
+    frame.setTextColor(GxEPD_BLACK);
 
     drawString(x + offset, y + 4 + offset + radius, "S", CENTER);
     drawString(x - radius - 10 + offset, y - 3 + offset, "W", CENTER);
@@ -1252,10 +2568,10 @@ void displayWind(int x, int y, float angle, float windspeed, int radius) {
     
     drawString(x + offset, y - 16 + offset, String(windspeed, 1), CENTER);
 
-    display.setFont(); // use default 6x8 font
+    frame.setFont(); // use default 6x8 font
     drawString(x + offset + 3, y - 15 + offset, "km/h", CENTER);
 
-    display.setFont(&DejaVu_Sans_Bold_11);
+    frame.setFont(&DejaVu_Sans_Bold_11);
     drawString(x + offset, y + 10 + offset, String(angle, 0) + "'", CENTER);
 }
 
@@ -1265,28 +2581,21 @@ void displayWind(int x, int y, float angle, float windspeed, int radius) {
  * @param x Display x coordinates
  * @param y Display y coordinates
  * @param asize Arrow size in pixels
- * @param aangle Arrow angle
+ * @param aangle Arrow angle in degrees
  * @param pwidth Arrow width
  * @param plength Arrow length
  * @param colour Colour to draw/fill the arrow
  */
-void arrow(int x, int y, int asize, float aangle, int pwidth, int plength, uint16_t colour) {
-    float dx = (asize - 10) * cos((aangle - 90) * PI / 180) + x; // calculate X position
-    float dy = (asize - 10) * sin((aangle - 90) * PI / 180) + y; // calculate Y position
-    float x1 = 0;
-    float y1 = plength;
-    float x2 = pwidth / 2;
-    float y2 = pwidth / 2;
-    float x3 = -pwidth / 2;
-    float y3 = pwidth / 2;
-    float angle = aangle * PI / 180 - 135;
-    float xx1 = x1 * cos(angle) - y1 * sin(angle) + dx;
-    float yy1 = y1 * cos(angle) + x1 * sin(angle) + dy;
-    float xx2 = x2 * cos(angle) - y2 * sin(angle) + dx;
-    float yy2 = y2 * cos(angle) + x2 * sin(angle) + dy;
-    float xx3 = x3 * cos(angle) - y3 * sin(angle) + dx;
-    float yy3 = y3 * cos(angle) + x3 * sin(angle) + dy;
-    display.fillTriangle(xx1, yy1, xx3, yy3, xx2, yy2, colour);
+void arrow(int x, int y, int asize, int aangle, int pwidth, int plength, uint16_t colour) {
+    int dx = trigMul(asize - 10, degSin(aangle)) + x;  // calculate X position
+    int dy = -trigMul(asize - 10, degCos(aangle)) + y; // calculate Y position
+    int xx1, yy1, xx2, yy2, xx3, yy3;
+
+    // The tip points along +y, turn it round so it points away from the centre
+    rotate(0, plength, aangle + 180, xx1, yy1);
+    rotate(pwidth / 2, pwidth / 2, aangle + 180, xx2, yy2);
+    rotate(-pwidth / 2, pwidth / 2, aangle + 180, xx3, yy3);
+    frame.fillTriangle(xx1 + dx, yy1 + dy, xx3 + dx, yy3 + dy, xx2 + dx, yy2 + dy, colour);
 }
 
 /**
@@ -1380,33 +2689,23 @@ void displayWeatherForecast(int x, int y) {
     for (byte i = 0; i < 5; i++) {
         displaySingleForecast(x + offset * i, y, offset, i);
     }
+}
 
-    float temperature[forecast_counter] = {0};
-    float pressure[forecast_counter] = {0};
-    float feels_like[forecast_counter] = {0};
-    // float humidity [forecast_counter] = {0};
-    // float rainfall [forecast_counter] = {0};
-
-    for (byte i = 0; i < forecast_counter; i++) {
-        temperature[i] = forecast[i].temperature;
-        pressure[i] = forecast[i].pressure;
-        feels_like[i] = forecast[i].feels_like;
-        // humidity [i] = forecast[i].humidity;
-        // rainfall [i] = forecast[i].rain;
-    }
-
-    //(x, y, w, h, Data[], lengthofdata, title)
-    // drawSingleGraph(155, 205, 96, 75, temperature, forecast_counter, "Temperature");
-
-    drawSingleGraph(155, 209, 96, 75, pressure, forecast_counter, "Pressure (hPa)"); // x=295
-
-
-    // drawSingleGraph(295, 205, 96, 75, humidity, forecast_counter, "Humidity (%)");
-    //(x, y, w, h, Data1[], Data2[], lengthofdata, title)
+/**
+ * @brief Display the graph of the forecast pressure.
+ * 
+ * @param x Display x coordinates of the graph
+ * @param y Display y coordinates of the graph
+ */
+void displayPressureGraph(int x, int y) {
+    const GraphSeries pressure[] = {seriesOf(forecast.pressure)};
 
-    //drawGraph(20, 209, 96, 75, temperature, feels_like, forecast_counter, "Temp & Feels"); //x = 155
+    drawGraph(x, y, 96, 75, pressure, forecast_counter, "Pressure (hPa)");
 
-    //drawGraph(295, 205, 96, 75, humidity, rainfall, forecast_counter, "Hum. & Rain (mm)");
+    // Other graphs that fit the box:
+    // {seriesOf(forecast.temperature)}, "Temperature"
+    // {seriesOf(forecast.humidity)}, "Humidity (%)"
+    // {seriesOf(forecast.temperature), seriesOf(forecast.feels_like, GRAPH_AREA)}, "Temp & Feels"
 }
 
 /**
@@ -1418,16 +2717,25 @@ void displayWeatherForecast(int x, int y) {
  * @param index The index of the forecast to display
  */
 void displaySingleForecast(int x, int y, int offset, int index) {
-    displayWeatherIcon(x + offset / 2 + 1, y + 35, forecast[index].icon, small_icon);
-
-    drawString(x + offset / 2, y + 3, String(forecast[index].period.substring(11, 16)), CENTER);
-    drawString(x + offset / 2, y + 50, String(forecast[index].high, 0) + "/" + String(forecast[index].low, 0), CENTER);
+    displayWeatherIcon(x + offset / 2 + 1, y + 35, forecast.icon[index], small_icon);
+
+    char period[6] = ""; // "12:00", UTC like the dt_txt of the API
+    if (forecast.dt[index] != 0) {
+        time_t dt = forecast.dt[index];
+        struct tm tm;
+        strftime(period, sizeof(period), "%H:%M", gmtime_r(&dt, &tm));
+    }
+    drawString(x + offset / 2, y + 3, period, CENTER);
+    char text[16];
+    snprintf(text, sizeof(text), "%.0f/%.0f", forecast.high[index], forecast.low[index]);
+    drawString(x + offset / 2, y + 50, text, CENTER);
     
     // ROUNDED WINDSPEED in km/h : //
-    display.setFont(); // smaller font
-    int kmh_rounded = (int)(forecast[index].wind_speed + .5);
-    drawString(x + offset / 2, y + 55, String(kmh_rounded) + String("km/h"), CENTER); 
-    display.setFont(&DejaVu_Sans_Bold_11); // revert to normal font
+    frame.setFont(); // smaller font
+    int kmh_rounded = (int)(forecast.wind_speed[index] + .5);
+    snprintf(text, sizeof(text), "%dkm/h", kmh_rounded);
+    drawString(x + offset / 2, y + 55, text, CENTER); 
+    frame.setFont(&DejaVu_Sans_Bold_11); // revert to normal font
 }
 
 /**
@@ -1447,6 +2755,60 @@ String convertUnixTime(uint32_t unix_time)
     return output;
 }
 
+/*
+ * Pre-rasterized weather icon: the black pixels of an icon procedure's output, packed 1 bit per
+ * pixel (1 = black, most significant bit first) with every row padded to whole bytes. dx/dy place
+ * the top left corner relative to the point the procedure draws around.
+ */
+typedef struct icon_bitmap {
+    const uint8_t *bits; // NULL = not in the atlas, draw the icon procedurally
+    int8_t dx, dy;
+    uint8_t w, h;
+} icon_bitmap;
+
+// include/iconAtlas.h is generated on the host by the [env:icon-atlas] build and committed, without it every icon
+// is drawn procedurally
+#if !ICON_ATLAS_GENERATE && __has_include("iconAtlas.h")
+#include "iconAtlas.h"
+#define ICON_ATLAS true
+#else
+#define ICON_ATLAS false
+#endif
+
+/*
+ * Icon drawing dispatch, indexed by weather_icon. The colour is passed to the draw function
+ * and is used for the sun and lightning, red during the day and black at night.
+ */
+typedef void (*icon_draw_fn)(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color);
+
+typedef struct icon_entry {
+    icon_draw_fn draw;
+    uint16_t colour;
+} icon_entry;
+
+constexpr icon_entry icon_table[ICON_COUNT] = {
+    {noData, GxEPD_BLACK},           // ICON_NONE
+    {noData, GxEPD_BLACK},           // unused
+    {sunnyIcon, GxEPD_RED},          // 01d, sun
+    {sunnyIcon, GxEPD_BLACK},        // 01n
+    {mostlySunnyIcon, GxEPD_RED},    // 02d, few clouds (clouds and sun)
+    {mostlySunnyIcon, GxEPD_BLACK},  // 02n
+    {cloudyIcon, GxEPD_RED},         // 03d, scattered clouds, no sun
+    {cloudyIcon, GxEPD_BLACK},       // 03n
+    {veryCloudyIcon, GxEPD_RED},     // 04d, broken clouds, more clouds than scatterred!
+    {veryCloudyIcon, GxEPD_BLACK},   // 04n
+    {chanceOfRainIcon, GxEPD_RED},   // 09d
+    {chanceOfRainIcon, GxEPD_BLACK}, // 09n
+    {rainIcon, GxEPD_RED},           // 10d
+    {rainIcon, GxEPD_BLACK},         // 10n
+    {thunderStormIcon, GxEPD_RED},   // 11d
+    {thunderStormIcon, GxEPD_BLACK}, // 11n
+    {snowIcon, GxEPD_RED},           // 13d
+    {snowIcon, GxEPD_BLACK},         // 13n
+    {mistIcon, GxEPD_RED},           // 50d
+    {mistIcon, GxEPD_BLACK},         // 50n
+};
+
 /**
  * @brief Display the current weather as an icon
  * 
@@ -1455,39 +2817,242 @@ String convertUnixTime(uint32_t unix_time)
  * @param icon Icon to display as set by openweathermap.org
  * @param large_icon If this is a large icon or not
  */
-void displayWeatherIcon(int x, int y, String icon, bool large_icon) {
+void displayWeatherIcon(int x, int y, weather_icon icon, bool large_icon) {
     if (large_icon) { // == large icon, TODO: need to change this logic, variable name!
         x = x + 65;
         y = y + 65;
     }
-    
-    if (icon == "01d") { // sun
-        sunnyIcon(x, y, large_icon, icon, GxEPD_RED);
-    } else if (icon == "01n") {
-        sunnyIcon(x, y, large_icon, icon, GxEPD_BLACK);
-    } else if (icon == "02d") { // few clouds (clouds and sun)
-        mostlySunnyIcon(x, y, large_icon, icon, GxEPD_RED);
-    } else if (icon == "02n") {
-        mostlySunnyIcon(x, y, large_icon, icon, GxEPD_BLACK);
-    } else if (icon == "03d" || icon == "03n") { // scattered clouds, no sun
-        cloudyIcon(x, y, large_icon, icon);
-    } else if (icon == "04d" || icon == "04n") { // broken clouds, more clouds than scatterred!
-        veryCloudyIcon(x, y, large_icon, icon);
-    } else if (icon == "09d") {
-        chanceOfRainIcon(x, y, large_icon, icon, GxEPD_RED);
-    } else if (icon == "09n") {
-        chanceOfRainIcon(x, y, large_icon, icon, GxEPD_BLACK);
-    } else if (icon == "10d" || icon == "10n") {
-        rainIcon(x, y, large_icon, icon);
-    } else if (icon == "11d" || icon == "11n") {
-        thunderStormIcon(x, y, large_icon, icon);
-    } else if (icon == "13d" || icon == "13n") {
-        snowIcon(x, y, large_icon, icon);
-    } else if (icon == "50d" || icon == "50n") {
-        mistIcon(x, y, large_icon, icon);
-    } else {
-        noData(x, y, large_icon);
+
+    if (icon >= ICON_COUNT) {
+        icon = ICON_NONE;
+    }
+
+    #if ICON_ATLAS
+    const icon_bitmap &bitmap = icon_atlas[large_icon][icon];
+    if (bitmap.bits != NULL) {
+        blitIcon(x, y, bitmap);
+        return;
+    }
+    #endif
+
+    const icon_entry &entry = icon_table[icon];
+    entry.draw(x, y, large_icon, icon, entry.colour);
+}
+
+/**
+ * @brief Copy the black pixels of a pre-rasterized icon into the frame, a shifted AND of whole
+ * bytes per row. Pixels that are white in the icon are left as they are.
+ * 
+ * @param x Display x coordinates the icon is drawn around
+ * @param y Display y coordinates the icon is drawn around
+ * @param bitmap Icon from icon_atlas
+ */
+void blitIcon(int x, int y, const icon_bitmap &bitmap) {
+    const int stride = (SCREEN_WIDTH + 7) / 8;
+    const int bytes = (bitmap.w + 7) / 8;
+
+    x += bitmap.dx;
+    y += bitmap.dy;
+    if (x < 0 || y < 0 || x + bitmap.w > (int)SCREEN_WIDTH || y + bitmap.h > (int)SCREEN_HEIGHT || frame.getRotation() != 0) {
+        frame.drawBitmap(x, y, bitmap.bits, bitmap.w, bitmap.h, GxEPD_BLACK); // clipped, let the canvas handle it
+        return;
+    }
+
+    // The canvas stores black as 0
+    uint8_t *row = frame.getBuffer() + y * stride + x / 8;
+    const uint8_t *bits = bitmap.bits;
+    const int shift = x & 7;
+    const int last = stride - x / 8 - 1; // last byte of the frame row, relative to row
+
+    for (int j = 0; j < bitmap.h; j++, row += stride) {
+        for (int i = 0; i < bytes; i++) {
+            uint8_t b = pgm_read_byte(bits++);
+            row[i] &= ~(b >> shift);
+            if (shift && i < last) {
+                row[i + 1] &= ~(uint8_t)(b << (8 - shift));
+            }
+        }
+    }
+}
+
+#if ICON_ATLAS_GENERATE
+/**
+ * @brief Pack the black pixels of a box of the frame into icon atlas rows.
+ * 
+ * @param x Left edge of the box
+ * @param y Top edge of the box
+ * @param w Width of the box
+ * @param row Row of the box to pack
+ * @param out At least (w + 7) / 8 bytes
+ */
+void packIconRow(int x, int y, int w, int row, uint8_t *out) {
+    memset(out, 0, (w + 7) / 8);
+    for (int i = 0; i < w; i++) {
+        if (!frame.getPixel(x + i, y + row)) {
+            out[i / 8] |= 0x80 >> (i & 7);
+        }
+    }
+}
+
+/**
+ * @brief Run every icon procedure once for the small and large size and print the results as
+ * include/iconAtlas.h between two marker lines. The [env:icon-atlas] host build runs this and
+ * writes the header (native/iconAtlas.py), rerun it whenever an icon procedure changes. Text
+ * icons (noData) are left out, they are cheap to draw and change the current font.
+ * 
+ */
+void printIconAtlas(void) {
+    static const char *const names[ICON_COUNT] = {
+        "none", "unused", "01d", "01n", "02d", "02n", "03d", "03n", "04d", "04n",
+        "09d", "09n", "10d", "10n", "11d", "11n", "13d", "13n", "50d", "50n"};
+    static const char *const sizes[2] = {"small", "large"};
+    const int ax = SCREEN_WIDTH / 2; // icons are drawn around the centre of the frame
+    const int ay = SCREEN_HEIGHT / 2;
+
+    icon_bitmap atlas[2][ICON_COUNT] = {};
+    uint32_t crcs[2][ICON_COUNT] = {};
+    uint8_t shared[2][ICON_COUNT]; // icon whose bitmap this one reuses
+    uint8_t row[(SCREEN_WIDTH + 7) / 8];
+
+    Serial.println("-----BEGIN ICON ATLAS-----");
+    Serial.println("#pragma once");
+    Serial.println();
+    Serial.println("/***************************************************************************************");
+    Serial.println("** Description:   weather icon atlas, generated by the [env:icon-atlas] build, do not edit");
+    Serial.println("***************************************************************************************/");
+    Serial.printf("static_assert(ICON_COUNT == %u, \"icon atlas is out of date, regenerate it with [env:icon-atlas]\");\n", ICON_COUNT);
+
+    for (uint8_t large = 0; large < 2; large++) {
+        for (uint8_t icon = 0; icon < ICON_COUNT; icon++) {
+            const icon_entry &entry = icon_table[icon];
+            shared[large][icon] = icon;
+            if (entry.draw == noData) {
+                continue;
+            }
+
+            frame.fillScreen(GxEPD_WHITE);
+            entry.draw(ax, ay, large, (weather_icon)icon, entry.colour);
+
+            // Bounding box of the black pixels
+            int x0 = SCREEN_WIDTH, y0 = SCREEN_HEIGHT, x1 = -1, y1 = -1;
+            for (int y = 0; y < (int)SCREEN_HEIGHT; y++) {
+                for (int x = 0; x < (int)SCREEN_WIDTH; x++) {
+                    if (!frame.getPixel(x, y)) {
+                        x0 = min(x0, x);
+                        x1 = max(x1, x);
+                        y0 = min(y0, y);
+                        y1 = max(y1, y);
+                    }
+                }
+            }
+
+            icon_bitmap &bitmap = atlas[large][icon];
+            int w = x1 - x0 + 1;
+            int h = y1 - y0 + 1;
+            if (x1 < 0 || x0 == 0 || y0 == 0 || x1 == (int)SCREEN_WIDTH - 1 || y1 == (int)SCREEN_HEIGHT - 1 ||
+                w > UINT8_MAX || h > UINT8_MAX || x0 - ax < INT8_MIN || y0 - ay < INT8_MIN) {
+                Serial.printf("// %s %s: empty, clipped or too large, drawn procedurally\n", sizes[large], names[icon]);
+                continue;
+            }
+            bitmap.dx = x0 - ax;
+            bitmap.dy = y0 - ay;
+            bitmap.w = w;
+            bitmap.h = h;
+            bitmap.bits = row; // any non NULL value, marks the entry as used
+
+            uint32_t crc = 0;
+            for (int j = 0; j < h; j++) {
+                packIconRow(x0, y0, w, j, row);
+                crc = crc32_le(crc, row, (w + 7) / 8);
+            }
+            crcs[large][icon] = crc;
+
+            // Day and night often come out the same, print the bitmap only once
+            for (uint8_t other = 0; other < icon; other++) {
+                const icon_bitmap &o = atlas[large][other];
+                if (o.bits != NULL && crcs[large][other] == crc && o.dx == bitmap.dx && o.dy == bitmap.dy && o.w == w && o.h == h) {
+                    shared[large][icon] = other;
+                    break;
+                }
+            }
+            if (shared[large][icon] != icon) {
+                continue;
+            }
+
+            Serial.printf("const unsigned char ICON_%s_%s[] PROGMEM = {", sizes[large], names[icon]);
+            int count = 0;
+            for (int j = 0; j < h; j++) {
+                packIconRow(x0, y0, w, j, row);
+                for (int i = 0; i < (w + 7) / 8; i++, count++) {
+                    Serial.printf("%s0x%02x,", count % 16 ? " " : "\n  ", row[i]);
+                }
+            }
+            Serial.println("\n};");
+        }
+    }
+
+    Serial.println();
+    Serial.println("const icon_bitmap icon_atlas[2][ICON_COUNT] PROGMEM = {");
+    for (uint8_t large = 0; large < 2; large++) {
+        Serial.printf("  { // %s\n", sizes[large]);
+        for (uint8_t icon = 0; icon < ICON_COUNT; icon++) {
+            const icon_bitmap &bitmap = atlas[large][icon];
+            if (bitmap.bits == NULL) {
+                Serial.printf("    {NULL, 0, 0, 0, 0}, // %s\n", names[icon]);
+            } else {
+                Serial.printf("    {ICON_%s_%s, %d, %d, %u, %u}, // %s\n", sizes[large], names[shared[large][icon]],
+                              bitmap.dx, bitmap.dy, bitmap.w, bitmap.h, names[icon]);
+            }
+        }
+        Serial.println("  },");
+    }
+    Serial.println("};");
+    Serial.println("-----END ICON ATLAS-----");
+}
+#endif
+
+/**
+ * @brief Convert an openweathermap.org icon code, e.g. "10n", to a weather_icon.
+ * 
+ * @param code Icon code as returned by the API, may be NULL
+ * @return weather_icon Matching icon or ICON_NONE if the code is not recognised
+ */
+weather_icon parseWeatherIcon(const char *code) {
+    static const uint8_t conditions[] = {1, 2, 3, 4, 9, 10, 11, 13, 50}; // same order as weather_icon
+
+    if (code == NULL || !isdigit(code[0]) || !isdigit(code[1]) || (code[2] != 'd' && code[2] != 'n')) {
+        return ICON_NONE;
     }
+
+    uint8_t condition = (code[0] - '0') * 10 + (code[1] - '0');
+    for (uint8_t i = 0; i < sizeof(conditions); i++) {
+        if (conditions[i] == condition) {
+            return (weather_icon)(ICON_CLEAR_DAY + i * 2 + (code[2] == 'n' ? 1 : 0));
+        }
+    }
+    return ICON_NONE;
+}
+
+/**
+ * @brief Convert a pegelonline.wsv.de measurement state, e.g. "normal", to a water_state.
+ * 
+ * @param state State as returned by the API, may be NULL
+ * @return water_state Matching state or WATER_STATE_UNKNOWN
+ */
+water_state parseWaterState(const char *state) {
+    if (state == NULL)
+        return WATER_STATE_UNKNOWN;
+    if (strcmp(state, "normal") == 0)
+        return WATER_STATE_NORMAL;
+    if (strcmp(state, "low") == 0)
+        return WATER_STATE_LOW;
+    if (strcmp(state, "high") == 0)
+        return WATER_STATE_HIGH;
+    if (strcmp(state, "commented") == 0)
+        return WATER_STATE_COMMENTED;
+    if (strcmp(state, "out-dated") == 0)
+        return WATER_STATE_OUTDATED;
+    return WATER_STATE_UNKNOWN;
 }
 
 /**
@@ -1496,10 +3061,10 @@ void displayWeatherIcon(int x, int y, String icon, bool large_icon) {
  * @param x Display x coordinates
  * @param y Display y coordinates
  * @param large_size Large or small icon
- * @param icon_name Icon name, looking to see if this is a day or night icon
+ * @param icon Icon, looking to see if this is a day or night icon
  * @param icon_color Icon colour
  */
-void sunnyIcon(int x, int y, bool large_size, String icon_name, uint16_t icon_color) {
+void sunnyIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color) {
     int scale = SMALL;
     int offset = 0;
 
@@ -1508,7 +3073,7 @@ void sunnyIcon(int x, int y, bool large_size, String icon_name, uint16_t icon_co
         offset = 0;
     }
 
-    if (icon_name.endsWith("n")) { // Night time, show stars
+    if ((icon & 1)) { // Night time, show stars
         addMoon(x, y + offset, scale);
         addSun(x, y + offset, scale, large_size, icon_color);
     } else { // Day time, show sun
@@ -1523,10 +3088,10 @@ void sunnyIcon(int x, int y, bool large_size, String icon_name, uint16_t icon_co
  * @param x Display x coordinates
  * @param y Display y coordinates
  * @param large_size Large or small icon
- * @param icon_name Icon name, looking to see if this is a day or night icon
+ * @param icon Icon, looking to see if this is a day or night icon
  * @param icon_color Icon colour
  */
-void mostlySunnyIcon(int x, int y, bool large_size, String icon_name, uint16_t icon_color) {
+void mostlySunnyIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color) {
     int scale = SMALL;
     int offset = 0;
     int linesize = 3;
@@ -1540,7 +3105,7 @@ void mostlySunnyIcon(int x, int y, bool large_size, String icon_name, uint16_t i
         linesize = 1;
     }
 
-    if (icon_name.endsWith("n")) { // Night time, add stars
+    if ((icon & 1)) { // Night time, add stars
         addMoon(x, y + offset, scale);
     } else { // Day time, add sun
         addSun(x - scale * 1.8, y - scale * 1.8 + offset, scale, large_size, icon_color);
@@ -1560,9 +3125,10 @@ void mostlySunnyIcon(int x, int y, bool large_size, String icon_name, uint16_t i
  * @param x Display x coordinates
  * @param y Display y coordinates
  * @param large_size Large or small icon
- * @param icon_name Icon name, looking to see if this is a day or night icon
+ * @param icon Icon, looking to see if this is a day or night icon
+ * @param icon_color Icon colour, red during the day time
  */
-void cloudyIcon(int x, int y, bool large_size, String icon_name) {
+void cloudyIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color) {
     int scale = SMALL;
     int offset = 0;
     int linesize = 3;
@@ -1573,18 +3139,18 @@ void cloudyIcon(int x, int y, bool large_size, String icon_name) {
     }
 
     if (scale == SMALL) {
-        if (icon_name.endsWith("n")) {
+        if ((icon & 1)) {
             addMoon(x, y + offset, scale);
         } else {
-            addSun(x - scale * 1.8, y - scale * 1.8 + offset, scale, large_size, GxEPD_RED);
+            addSun(x - scale * 1.8, y - scale * 1.8 + offset, scale, large_size, icon_color);
         }
         linesize = 1;
         addCloud(x, y + offset, scale, linesize);
     } else {
-        if (icon_name.endsWith("n")) {
+        if ((icon & 1)) {
             addMoon(x, y + offset, scale);
         } else { // Day time, add sun
-            addSun(x - scale * 1.8, y - scale * 1.8 + offset, scale, large_size, GxEPD_RED);
+            addSun(x - scale * 1.8, y - scale * 1.8 + offset, scale, large_size, icon_color);
         }
     }
 
@@ -1597,9 +3163,10 @@ void cloudyIcon(int x, int y, bool large_size, String icon_name) {
  * @param x Display x coordinates
  * @param y Display y coordinates
  * @param large_size Large or small icon
- * @param icon_name Icon name, looking to see if this is a day or night icon
+ * @param icon Icon, looking to see if this is a day or night icon
+ * @param icon_color Icon colour, red during the day time
  */
-void veryCloudyIcon(int x, int y, bool large_size, String icon_name) {
+void veryCloudyIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color) {
     int scale = SMALL;
     int offset = 0;
     int linesize = 3;
@@ -1610,7 +3177,7 @@ void veryCloudyIcon(int x, int y, bool large_size, String icon_name) {
     }
 
     if (scale == SMALL) {
-        if (icon_name.endsWith("n"))
+        if ((icon & 1))
             addMoon(x, y + offset, scale);
 
         linesize = 1;
@@ -1618,7 +3185,7 @@ void veryCloudyIcon(int x, int y, bool large_size, String icon_name) {
         addCloud(x + 8, y - 10 + offset, 2, linesize); // Right v.small
         addCloud(x, y + offset, scale, linesize);      // Main cloud
     } else {
-        if (icon_name.endsWith("n")) {
+        if ((icon & 1)) {
             addMoon(x, y + offset, scale);
         }
 
@@ -1634,10 +3201,10 @@ void veryCloudyIcon(int x, int y, bool large_size, String icon_name) {
  * @param x Display x coordinates
  * @param y Display y coordinates
  * @param large_size Large or small icon
- * @param icon_name Icon name, looking to see if this is a day or night icon
+ * @param icon Icon, looking to see if this is a day or night icon
  * @param icon_color Icon colour
  */
-void chanceOfRainIcon(int x, int y, bool large_size, String icon_name, uint16_t icon_color) {
+void chanceOfRainIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color) {
     int scale = SMALL;
     int offset = 0;
     int linesize = 3;
@@ -1651,7 +3218,7 @@ void chanceOfRainIcon(int x, int y, bool large_size, String icon_name, uint16_t
         linesize = 1;
     }
 
-    if (icon_name.endsWith("n")) {
+    if ((icon & 1)) {
         addMoon(x, y + offset, scale);
     } else {
         addSun(x - scale * 1.8, y - scale * 1.8 + offset, scale, large_size, icon_color);
@@ -1667,9 +3234,10 @@ void chanceOfRainIcon(int x, int y, bool large_size, String icon_name, uint16_t
  * @param x Display x coordinates
  * @param y Display y coordinates
  * @param large_size Large or small icon
- * @param icon_name Icon name, looking to see if this is a day or night icon
+ * @param icon Icon, looking to see if this is a day or night icon
+ * @param icon_color Icon colour, red during the day time
  */
-void rainIcon(int x, int y, bool large_size, String icon_name) {
+void rainIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color) {
     int scale = SMALL;
     int offset = 0;
     int linesize = 3;
@@ -1683,7 +3251,7 @@ void rainIcon(int x, int y, bool large_size, String icon_name) {
         linesize = 1;
     }
 
-    if (icon_name.endsWith("n")) {
+    if ((icon & 1)) {
         addMoon(x, y + offset, scale);
     }
     
@@ -1697,9 +3265,10 @@ void rainIcon(int x, int y, bool large_size, String icon_name) {
  * @param x Display x coordinates
  * @param y Display y coordinates
  * @param large_size Large or small icon
- * @param icon_name Icon name, looking to see if this is a day or night icon
+ * @param icon Icon, looking to see if this is a day or night icon
+ * @param icon_color Icon colour, red during the day time
  */
-void thunderStormIcon(int x, int y, bool large_size, String icon_name) {
+void thunderStormIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color) {
     int scale = SMALL;
     int offset = 0;
     int linesize = 3;
@@ -1713,12 +3282,10 @@ void thunderStormIcon(int x, int y, bool large_size, String icon_name) {
         linesize = 1;
     }
 
-    if (icon_name.endsWith("n")) {
+    if ((icon & 1)) {
         addMoon(x, y + offset, scale);
-        addThunderStorm(x, y + offset, scale, GxEPD_BLACK);
-    } else {
-        addThunderStorm(x, y + offset, scale, GxEPD_RED);
     }
+    addThunderStorm(x, y + offset, scale, icon_color);
 
     addCloud(x, y + offset, scale, linesize);
 }
@@ -1729,9 +3296,10 @@ void thunderStormIcon(int x, int y, bool large_size, String icon_name) {
  * @param x Display x coordinates
  * @param y Display y coordinates
  * @param large_size Large or small icon
- * @param icon_name Icon name, looking to see if this is a day or night icon
+ * @param icon Icon, looking to see if this is a day or night icon
+ * @param icon_color Icon colour, red during the day time
  */
-void snowIcon(int x, int y, bool large_size, String icon_name) {
+void snowIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color) {
     int scale = SMALL;
     int offset = 0;
     int linesize = 3;
@@ -1745,7 +3313,7 @@ void snowIcon(int x, int y, bool large_size, String icon_name) {
         linesize = 1;
     }
 
-    if (icon_name.endsWith("n")) {
+    if ((icon & 1)) {
         addMoon(x, y + offset, scale);
     }
     
@@ -1759,9 +3327,10 @@ void snowIcon(int x, int y, bool large_size, String icon_name) {
  * @param x Display x coordinates
  * @param y Display y coordinates
  * @param large_size Large or small icon
- * @param icon_name Icon name, looking to see if this is a day or night icon
+ * @param icon Icon, looking to see if this is a day or night icon
+ * @param icon_color Icon colour, red during the day time
  */
-void mistIcon(int x, int y, bool large_size, String icon_name) {
+void mistIcon(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color) {
     int scale = SMALL;
     int offset = 0;
     int linesize = 3;
@@ -1775,7 +3344,7 @@ void mistIcon(int x, int y, bool large_size, String icon_name) {
         linesize = 1;
     }
 
-    if (icon_name.endsWith("n")) {
+    if ((icon & 1)) {
         addMoon(x, y + offset, scale);
     } 
     
@@ -1793,35 +3362,35 @@ void sunRiseSetIcon(uint16_t x, uint16_t y, sun_direction direction) {
     uint16_t r = 7;
 
     // Horizontal
-    display.drawLine(x - r * 2 + 2, y, x + r * 2 - 2, y, GxEPD_BLACK);
+    frame.drawLine(x - r * 2 + 2, y, x + r * 2 - 2, y, GxEPD_BLACK);
     // Vertical
-    display.drawLine(x, y - r * 2 + 2, x, y, GxEPD_BLACK);
+    frame.drawLine(x, y - r * 2 + 2, x, y, GxEPD_BLACK);
     // Angle Top right
-    display.drawLine(x - r * 2 + 5, y - r * 2 + 5, x, y, GxEPD_BLACK);
+    frame.drawLine(x - r * 2 + 5, y - r * 2 + 5, x, y, GxEPD_BLACK);
     // Angle Top left
-    display.drawLine(x, y, x + r * 2 - 5, y - r * 2 + 5, GxEPD_BLACK);
+    frame.drawLine(x, y, x + r * 2 - 5, y - r * 2 + 5, GxEPD_BLACK);
     // Remove lines inside
-    display.fillCircle(x, y, r + 1, GxEPD_WHITE);
+    frame.fillCircle(x, y, r + 1, GxEPD_WHITE);
     // Empty inside
-    display.fillCircle(x, y, r - 1, GxEPD_RED);
-    display.drawCircle(x, y, r - 1, GxEPD_BLACK);
+    frame.fillCircle(x, y, r - 1, GxEPD_RED);
+    frame.drawCircle(x, y, r - 1, GxEPD_BLACK);
     // Overwrite the bottom
-    display.fillRect(x - r, y + 4, r * 2, r, GxEPD_WHITE);
+    frame.fillRect(x - r, y + 4, r * 2, r, GxEPD_WHITE);
 
     // Arrow up
     if (direction == SUN_UP) {
-        display.fillTriangle(x - r / 2 - 1, y + r - 2, x, y + r - 7, x + r / 2 + 1, y + r - 2, GxEPD_WHITE);
-        display.drawLine(x - r / 2, y + r - 2, x, y + r - 6, GxEPD_BLACK);
-        display.drawLine(x, y + r - 6, x + r / 2, y + r - 2, GxEPD_BLACK);
+        frame.fillTriangle(x - r / 2 - 1, y + r - 2, x, y + r - 7, x + r / 2 + 1, y + r - 2, GxEPD_WHITE);
+        frame.drawLine(x - r / 2, y + r - 2, x, y + r - 6, GxEPD_BLACK);
+        frame.drawLine(x, y + r - 6, x + r / 2, y + r - 2, GxEPD_BLACK);
     } else {
         // Arrow DOWN
-        display.drawLine(x - r / 2, y + r - 2, x, y + r + 2, GxEPD_BLACK);
-        display.drawLine(x, y + r + 2, x + r / 2, y + r - 2, GxEPD_BLACK);
+        frame.drawLine(x - r / 2, y + r - 2, x, y + r + 2, GxEPD_BLACK);
+        frame.drawLine(x, y + r + 2, x + r / 2, y + r - 2, GxEPD_BLACK);
     }
 
     // Horizon line
-    display.drawLine(x - r, y + r - 2, x - r / 2, y + r - 2, GxEPD_BLACK);
-    display.drawLine(x + r / 2, y + r - 2, x + r, y + r - 2, GxEPD_BLACK);
+    frame.drawLine(x - r, y + r - 2, x - r / 2, y + r - 2, GxEPD_BLACK);
+    frame.drawLine(x + r / 2, y + r - 2, x + r, y + r - 2, GxEPD_BLACK);
 }
 
 /**
@@ -1833,11 +3402,11 @@ void sunRiseSetIcon(uint16_t x, uint16_t y, sun_direction direction) {
  */
 void addMoon(int x, int y, int scale) {
     if (scale == LARGE) {
-        display.fillCircle(x - 37, y - 30, scale, GxEPD_BLACK);
-        display.fillCircle(x - 24, y - 30, scale * 1.6, GxEPD_WHITE);
+        frame.fillCircle(x - 37, y - 30, scale, GxEPD_BLACK);
+        frame.fillCircle(x - 24, y - 30, scale * 1.6, GxEPD_WHITE);
     } else {
-        display.fillCircle(x - 20, y - 15, scale, GxEPD_BLACK);
-        display.fillCircle(x - 15, y - 15, scale * 1.6, GxEPD_WHITE);
+        frame.fillCircle(x - 20, y - 15, scale, GxEPD_BLACK);
+        frame.fillCircle(x - 15, y - 15, scale * 1.6, GxEPD_WHITE);
     }
 }
 
@@ -1858,35 +3427,27 @@ void addSun(int x, int y, int scale, boolean icon_size, uint16_t icon_color) {
         linesize = 1;
     }
 
-    display.fillCircle(x, y, scale, icon_color);
+    frame.fillCircle(x, y, scale, icon_color);
     if (icon_color != GxEPD_RED) { // not day time or 2 colour display
-        display.fillCircle(x, y, scale - linesize, GxEPD_WHITE);
+        frame.fillCircle(x, y, scale - linesize, GxEPD_WHITE);
     }
 
-    for (float i = 0; i < 360; i = i + 45) {
-        dxo = 2.2 * scale * cos((i - 90) * 3.14 / 180);
-        dxi = dxo * 0.6;
-        dyo = 2.2 * scale * sin((i - 90) * 3.14 / 180);
-        dyi = dyo * 0.6;
-        if (i == 0 || i == 180) {
-            display.drawLine(dxo + x - 1, dyo + y, dxi + x - 1, dyi + y, GxEPD_BLACK);
-            if (icon_size == large_icon) {
-                display.drawLine(dxo + x + 0, dyo + y, dxi + x + 0, dyi + y, GxEPD_BLACK);
-                display.drawLine(dxo + x + 1, dyo + y, dxi + x + 1, dyi + y, GxEPD_BLACK);
-            }
-        }
-        if (i == 90 || i == 270) {
-            display.drawLine(dxo + x, dyo + y - 1, dxi + x, dyi + y - 1, GxEPD_BLACK);
+    for (int point = 0; point < 16; point += 2) {  // every 45 degrees
+        dxo = trigMul(22 * scale, compassSin(point)) / 10;
+        dxi = dxo * 6 / 10;
+        dyo = -trigMul(22 * scale, compassCos(point)) / 10;
+        dyi = dyo * 6 / 10;
+        if (point == 4 || point == 12) { // E and W rays are thickened vertically
+            frame.drawLine(dxo + x, dyo + y - 1, dxi + x, dyi + y - 1, GxEPD_BLACK);
             if (icon_size == large_icon) {
-                display.drawLine(dxo + x, dyo + y + 0, dxi + x, dyi + y + 0, GxEPD_BLACK);
-                display.drawLine(dxo + x, dyo + y + 1, dxi + x, dyi + y + 1, GxEPD_BLACK);
+                frame.drawLine(dxo + x, dyo + y + 0, dxi + x, dyi + y + 0, GxEPD_BLACK);
+                frame.drawLine(dxo + x, dyo + y + 1, dxi + x, dyi + y + 1, GxEPD_BLACK);
             }
-        }
-        if (i == 45 || i == 135 || i == 225 || i == 315) {
-            display.drawLine(dxo + x - 1, dyo + y, dxi + x - 1, dyi + y, GxEPD_BLACK);
+        } else {                        // the others horizontally
+            frame.drawLine(dxo + x - 1, dyo + y, dxi + x - 1, dyi + y, GxEPD_BLACK);
             if (icon_size == large_icon) {
-                display.drawLine(dxo + x + 0, dyo + y, dxi + x + 0, dyi + y, GxEPD_BLACK);
-                display.drawLine(dxo + x + 1, dyo + y, dxi + x + 1, dyi + y, GxEPD_BLACK);
+                frame.drawLine(dxo + x + 0, dyo + y, dxi + x + 0, dyi + y, GxEPD_BLACK);
+                frame.drawLine(dxo + x + 1, dyo + y, dxi + x + 1, dyi + y, GxEPD_BLACK);
             }
         }
     }
@@ -1902,17 +3463,17 @@ void addSun(int x, int y, int scale, boolean icon_size, uint16_t icon_color) {
  */
 void addCloud(int x, int y, int scale, int linesize) {
     // Draw cloud outer
-    display.fillCircle(x - scale * 3, y, scale, GxEPD_BLACK);                              // Left most circle
-    display.fillCircle(x + scale * 3, y, scale, GxEPD_BLACK);                              // Right most circle
-    display.fillCircle(x - scale, y - scale, scale * 1.4, GxEPD_BLACK);                    // left middle upper circle
-    display.fillCircle(x + scale * 1.5, y - scale * 1.3, scale * 1.75, GxEPD_BLACK);       // Right middle upper circle
-    display.fillRect(x - scale * 3 - 1, y - scale, scale * 6, scale * 2 + 1, GxEPD_BLACK); // Upper and lower lines
+    frame.fillCircle(x - scale * 3, y, scale, GxEPD_BLACK);                              // Left most circle
+    frame.fillCircle(x + scale * 3, y, scale, GxEPD_BLACK);                              // Right most circle
+    frame.fillCircle(x - scale, y - scale, scale * 1.4, GxEPD_BLACK);                    // left middle upper circle
+    frame.fillCircle(x + scale * 1.5, y - scale * 1.3, scale * 1.75, GxEPD_BLACK);       // Right middle upper circle
+    frame.fillRect(x - scale * 3 - 1, y - scale, scale * 6, scale * 2 + 1, GxEPD_BLACK); // Upper and lower lines
     // Clear cloud inner
-    display.fillCircle(x - scale * 3, y, scale - linesize, GxEPD_WHITE);                                                   // Clear left most circle
-    display.fillCircle(x + scale * 3, y, scale - linesize, GxEPD_WHITE);                                                   // Clear right most circle
-    display.fillCircle(x - scale, y - scale, scale * 1.4 - linesize, GxEPD_WHITE);                                         // left middle upper circle
-    display.fillCircle(x + scale * 1.5, y - scale * 1.3, scale * 1.75 - linesize, GxEPD_WHITE);                            // Right middle upper circle
-    display.fillRect(x - scale * 3 + 2, y - scale + linesize - 1, scale * 5.9, scale * 2 - linesize * 2 + 2, GxEPD_WHITE); // Upper and lower lines
+    frame.fillCircle(x - scale * 3, y, scale - linesize, GxEPD_WHITE);                                                   // Clear left most circle
+    frame.fillCircle(x + scale * 3, y, scale - linesize, GxEPD_WHITE);                                                   // Clear right most circle
+    frame.fillCircle(x - scale, y - scale, scale * 1.4 - linesize, GxEPD_WHITE);                                         // left middle upper circle
+    frame.fillCircle(x + scale * 1.5, y - scale * 1.3, scale * 1.75 - linesize, GxEPD_WHITE);                            // Right middle upper circle
+    frame.fillRect(x - scale * 3 + 2, y - scale + linesize - 1, scale * 5.9, scale * 2 - linesize * 2 + 2, GxEPD_WHITE); // Upper and lower lines
 }
 
 /**
@@ -1925,7 +3486,7 @@ void addCloud(int x, int y, int scale, int linesize) {
  */
 void addRain(int x, int y, int scale, uint16_t colour) {
     for (byte i = 0; i < 6; i++) {
-        display.fillCircle(x - scale * 4 + scale * i * 1.3, y + scale * 1.9 + (scale == SMALL ? 3 : 0), scale / 3, colour);
+        frame.fillCircle(x - scale * 4 + scale * i * 1.3, y + scale * 1.9 + (scale == SMALL ? 3 : 0), scale / 3, colour);
         arrow(x - scale * 4 + scale * i * 1.3 + (scale == SMALL ? 6 : 4), y + scale * 1.6 + (scale == SMALL ? -3 : -1), scale / 6, 40, scale / 1.6, scale * 1.2, colour);
     }
 }
@@ -1942,12 +3503,14 @@ void addSnow(int x, int y, int scale, uint16_t colour) {
     int dxo, dyo, dxi, dyi;
 
     for (byte flakes = 0; flakes < 5; flakes++) {
-        for (int i = 0; i < 360; i = i + 45) {
-            dxo = 0.5 * scale * cos((i - 90) * 3.14 / 180);
-            dxi = dxo * 0.1;
-            dyo = 0.5 * scale * sin((i - 90) * 3.14 / 180);
-            dyi = dyo * 0.1;
-            display.drawLine(dxo + x + 0 + flakes * 1.5 * scale - scale * 3, dyo + y + scale * 2, dxi + x + 0 + flakes * 1.5 * scale - scale * 3, dyi + y + scale * 2, colour);
+        int fx = x + flakes * 3 * scale / 2 - scale * 3;
+        int fy = y + scale * 2;
+        for (int point = 0; point < 16; point += 2) {  // every 45 degrees
+            dxo = trigMul(scale, compassSin(point)) / 2;
+            dxi = dxo / 10;
+            dyo = -trigMul(scale, compassCos(point)) / 2;
+            dyi = dyo / 10;
+            frame.drawLine(dxo + fx, dyo + fy, dxi + fx, dyi + fy, colour);
         }
     }
 }
@@ -1964,20 +3527,20 @@ void addThunderStorm(int x, int y, int scale, uint16_t colour) {
     y = y + scale / 2;
 
     for (byte i = 0; i < 5; i++) {
-        display.drawLine(x - scale * 4 + scale * i * 1.5 + 0, y + scale * 1.5, x - scale * 3.5 + scale * i * 1.5 + 0, y + scale, colour);
+        frame.drawLine(x - scale * 4 + scale * i * 1.5 + 0, y + scale * 1.5, x - scale * 3.5 + scale * i * 1.5 + 0, y + scale, colour);
         if (scale != SMALL) {
-            display.drawLine(x - scale * 4 + scale * i * 1.5 + 1, y + scale * 1.5, x - scale * 3.5 + scale * i * 1.5 + 1, y + scale, colour);
-            display.drawLine(x - scale * 4 + scale * i * 1.5 + 2, y + scale * 1.5, x - scale * 3.5 + scale * i * 1.5 + 2, y + scale, colour);
+            frame.drawLine(x - scale * 4 + scale * i * 1.5 + 1, y + scale * 1.5, x - scale * 3.5 + scale * i * 1.5 + 1, y + scale, colour);
+            frame.drawLine(x - scale * 4 + scale * i * 1.5 + 2, y + scale * 1.5, x - scale * 3.5 + scale * i * 1.5 + 2, y + scale, colour);
         }
-        display.drawLine(x - scale * 4 + scale * i * 1.5, y + scale * 1.5 + 0, x - scale * 3 + scale * i * 1.5 + 0, y + scale * 1.5 + 0, colour);
+        frame.drawLine(x - scale * 4 + scale * i * 1.5, y + scale * 1.5 + 0, x - scale * 3 + scale * i * 1.5 + 0, y + scale * 1.5 + 0, colour);
         if (scale != SMALL) {
-            display.drawLine(x - scale * 4 + scale * i * 1.5, y + scale * 1.5 + 1, x - scale * 3 + scale * i * 1.5 + 0, y + scale * 1.5 + 1, colour);
-            display.drawLine(x - scale * 4 + scale * i * 1.5, y + scale * 1.5 + 2, x - scale * 3 + scale * i * 1.5 + 0, y + scale * 1.5 + 2, colour);
+            frame.drawLine(x - scale * 4 + scale * i * 1.5, y + scale * 1.5 + 1, x - scale * 3 + scale * i * 1.5 + 0, y + scale * 1.5 + 1, colour);
+            frame.drawLine(x - scale * 4 + scale * i * 1.5, y + scale * 1.5 + 2, x - scale * 3 + scale * i * 1.5 + 0, y + scale * 1.5 + 2, colour);
         }
-        display.drawLine(x - scale * 3.5 + scale * i * 1.4 + 0, y + scale * 2.5, x - scale * 3 + scale * i * 1.5 + 0, y + scale * 1.5, colour);
+        frame.drawLine(x - scale * 3.5 + scale * i * 1.4 + 0, y + scale * 2.5, x - scale * 3 + scale * i * 1.5 + 0, y + scale * 1.5, colour);
         if (scale != SMALL) {
-            display.drawLine(x - scale * 3.5 + scale * i * 1.4 + 1, y + scale * 2.5, x - scale * 3 + scale * i * 1.5 + 1, y + scale * 1.5, colour);
-            display.drawLine(x - scale * 3.5 + scale * i * 1.4 + 2, y + scale * 2.5, x - scale * 3 + scale * i * 1.5 + 2, y + scale * 1.5, colour);
+            frame.drawLine(x - scale * 3.5 + scale * i * 1.4 + 1, y + scale * 2.5, x - scale * 3 + scale * i * 1.5 + 1, y + scale * 1.5, colour);
+            frame.drawLine(x - scale * 3.5 + scale * i * 1.4 + 2, y + scale * 2.5, x - scale * 3 + scale * i * 1.5 + 2, y + scale * 1.5, colour);
         }
     }
 }
@@ -1999,15 +3562,15 @@ void addFog(int x, int y, int scale, int linesize, uint16_t colour) {
     }
 
     for (byte i = 0; i < 6; i++) {
-        display.fillRect(((x + 5) - scale * 3) + offset, y - (scale * 3), scale * 3, linesize, colour);
+        frame.fillRect(((x + 5) - scale * 3) + offset, y - (scale * 3), scale * 3, linesize, colour);
 
-        display.fillRect(((x - scale) - scale * 2) + offset, y - (scale * 2), scale * 5, linesize, colour);
+        frame.fillRect(((x - scale) - scale * 2) + offset, y - (scale * 2), scale * 5, linesize, colour);
 
-        display.fillRect(((x - scale) - scale * 3) + offset, y - scale, scale * 4, linesize, colour);
+        frame.fillRect(((x - scale) - scale * 3) + offset, y - scale, scale * 4, linesize, colour);
 
-        display.fillRect((x - scale * 3) + offset, y, scale * 4, linesize, colour);
+        frame.fillRect((x - scale * 3) + offset, y, scale * 4, linesize, colour);
 
-        display.fillRect(((x + 5) - scale * 3) + offset, y + scale, scale * 3, linesize, colour); // bottom line
+        frame.fillRect(((x + 5) - scale * 3) + offset, y + scale, scale * 3, linesize, colour); // bottom line
     }
 }
 
@@ -2017,8 +3580,10 @@ void addFog(int x, int y, int scale, int linesize, uint16_t colour) {
  * @param x Display x coordinates
  * @param y Display y coordinates
  * @param large_size Used to set the font size to use 
+ * @param icon Unused, matches the icon_table signature
+ * @param icon_color Unused, matches the icon_table signature
  */
-void noData(int x, int y, bool large_size) {
+void noData(int x, int y, bool large_size, weather_icon icon, uint16_t icon_color) {
     int scale = SMALL;
     int offset = 0;
     if (large_size) {
@@ -2027,9 +3592,9 @@ void noData(int x, int y, bool large_size) {
     }
 
     if (scale == LARGE) {
-        display.setFont(&FreeMonoBold12pt7b);
+        frame.setFont(&FreeMonoBold12pt7b);
     } else {
-        display.setFont(&DejaVu_Sans_Bold_11);
+        frame.setFont(&DejaVu_Sans_Bold_11);
     }
 
     drawString(x - 20, y - 10 + offset, "N/A", LEFT);
@@ -2044,260 +3609,127 @@ void noData(int x, int y, bool large_size) {
  */
 void addStar(int x, int y, star_size starsize) {
     if (starsize == SMALL_STAR) {
-        display.drawTriangle(x, y, x - 2, y + 3, x + 2, y + 3, GxEPD_WHITE);
-        display.drawTriangle(x, y + 4, x - 2, y + 1, x + 2, y + 1, GxEPD_WHITE);
+        frame.drawTriangle(x, y, x - 2, y + 3, x + 2, y + 3, GxEPD_WHITE);
+        frame.drawTriangle(x, y + 4, x - 2, y + 1, x + 2, y + 1, GxEPD_WHITE);
     } else if (starsize == MEDIUM_STAR) {
-        display.drawTriangle(x, y, x - 4, y + 6, x + 4, y + 6, GxEPD_WHITE);
-        display.drawTriangle(x, y + 8, x - 4, y + 2, x + 4, y + 2, GxEPD_WHITE);
+        frame.drawTriangle(x, y, x - 4, y + 6, x + 4, y + 6, GxEPD_WHITE);
+        frame.drawTriangle(x, y + 8, x - 4, y + 2, x + 4, y + 2, GxEPD_WHITE);
     }
 }
 
 /**
- * @brief Draw graph with 2 sets of data
+ * @brief Draw a graph of one or more data series sharing one y scale. The scale is found in one
+ * pass over all values of all series, area series are drawn first so the lines stay on top.
  *
- * @param x     x coordinates
- * @param y     y coordinates
- * @param w     graph width
- * @param h     graph height
- * @param Data  Data array one
- * @param Data2 Data array two (null == empty array)
- * @param len   Length of data array
- * @param title graph title
- */
-void drawGraph(uint16_t x, uint16_t y, uint16_t w, uint16_t h, float Data[], float Data2[], int len, String title) {
-    float ymin;
-    float ymax;
-    int ticklines = 5;
-    int auto_scale_margin = 0;
-
-    int maxYscale = -10000;
-    int minYscale = 10000;
-
-    for (int i = 1; i < len; i++) {
-        if (Data[i] >= maxYscale) {
-            maxYscale = Data[i];
-        }
-        if (Data[i] <= minYscale) {
-            minYscale = Data[i];
-        }
-
-        if (Data2 != NULL) {
-            if (Data2[i] >= maxYscale) {
-                maxYscale = Data2[i];
-            }
-            if (Data2[i] <= minYscale) {
-                minYscale = Data2[i];
-            }
+ * @param x      x coordinates
+ * @param y      y coordinates
+ * @param w      graph width
+ * @param h      graph height
+ * @param series Data series
+ * @param count  Number of series
+ * @param len    Number of values in each series, at least 2
+ * @param title  graph title
+ */
+void drawGraphSeries(int x, int y, int w, int h, const GraphSeries *series, int count, int len, const char *title) {
+    const int ticklines = 5;
+    float vmin = INFINITY;
+    float vmax = -INFINITY;
+
+    for (int s = 0; s < count; s++) {
+        for (int i = 0; i < len; i++) {
+            float v = series[s][i];
+            vmin = min(vmin, v);
+            vmax = max(vmax, v);
         }
     }
-    maxYscale = round(maxYscale + auto_scale_margin); // Auto scale the graph and round to the nearest value defined, default was Y1Max
-    ymax = round(maxYscale + 0.5);
-    if (minYscale != 0) {
-        minYscale = round(minYscale - auto_scale_margin); // Auto scale the graph and round to the nearest value defined, default was Y1Min
+    if (count == 0 || len < 2 || !isfinite(vmin) || !isfinite(vmax)) {
+        vmin = 0;
+        vmax = 0;
     }
-    ymin = round(minYscale);
 
-    float steps = (ymax - ymin) / (ticklines);
+    // Whole numbers around the data, at least 1 apart
+    float ymin = floorf(vmin);
+    float ymax = floorf(vmax) + 1;
+    float steps = (ymax - ymin) / ticklines;
+    float scale = h / (ymax - ymin); // pixels per unit
 
     // Title
-    display.setFont();
+    frame.setFont();
     drawString(x + w / 2, y - 24, title, CENTER);
 
     // Draw y-axis tick markers and dashed lines
-    for (byte i = 0; i < ticklines + 1; i++) {
-        drawString(x - 2, y + ((h / ticklines) * i - 12), String(lrint(ymin + steps * (ticklines - i))), RIGHT);
-        if (i == 0) {
-            continue;
-        }
-        display.drawLine(x + 1, y + ((h / ticklines) * i), x + w - 1, y + ((h / ticklines) * i), GxEPD_RED);
-        bool blank = true;
-        for (byte r = 0; r < w; r = r + 3) {
-            if (blank) {
-                display.drawLine(x + r, y + ((h / ticklines) * i), x + r + 3, y + ((h / ticklines) * i), GxEPD_WHITE);
-                blank = false;
-            } else {
-                blank = true;
-            }
-        }
-    }
-
-    // x-Axis
-    display.drawLine(x, y + h, x + w, y + h, GxEPD_BLACK);
-
-    // y-Axis
-    display.drawLine(x, y, x, y + h, GxEPD_BLACK);
-
-    // Draw data line 1
-    float x1 = x + 1;
-    float y1 = y + (ymax - constrain(Data[0], ymin, ymax)) / (ymax - ymin) * h;
-    float y3 = y + (ymax - constrain(Data2[0], ymin, ymax)) / (ymax - ymin) * h;
-
-    if (y1 > y + h - 1)
-        y1 = y + h - 1;
-    if (y3 > y + h - 1)
-        y3 = y + h - 1;
-    float x2, y2, y4;
-
-    for (int i = 1; i < len; i++) {
-        x2 = x + i * w / (len - 1) - 1;
-        y2 = y + (ymax - constrain(Data[i], ymin, ymax)) / (ymax - ymin) * h + 1;
-        y4 = y + (ymax - constrain(Data2[i], ymin, ymax)) / (ymax - ymin) * h + 1;
-        
-        if (y2 > y + h - 1)
-            y2 = y + h - 1;
-        if (y4 > y + h - 1)
-            y4 = y + h - 1;
-
-        display.drawLine(x1, y3, x2, y4, GxEPD_RED);
-
-        for (byte r = 0; r < ceil(w / len) + 1; r++) {
-            float m = (y4 - y3) / (x2 - x1);
-            float b = y3 - m * x1;
-            display.drawLine(x1 + r, y + h - 1, x1 + r, m * (x1 + r) + b, GxEPD_RED);
-        }
-
-        display.drawLine(x1, y1 - 1, x2, y2 - 1, GxEPD_BLACK); // thicker line on display
-        display.drawLine(x1, y1, x2, y2, GxEPD_BLACK);
-
-        x1 = x2;
-        y1 = y2;
-        y3 = y4;
-    }
-
-    // x-Axis ticks
-    for (int i = 0; i <= 4; i++) {
-        if (i == 0) {
-            display.setCursor(x - 5 + (w / 4) * i, y + h + 6);
-        } else {
-            display.setCursor(x - 7 + (w / 4) * i, y + h + 6);
-        }
-        display.print(String(12 * i));
-    }
-
-    // Reset font
-    display.setFont(&DejaVu_Sans_Bold_11);
-}
-
-/**
- * @brief Draw graph with 1 set of data
- *
- * @param x     x coordinates
- * @param y     y coordinates
- * @param w     graph width
- * @param h     graph height
- * @param Data  Data array
- * @param len   Length of data array
- * @param title graph title
- */
-void drawSingleGraph(uint16_t x, uint16_t y, uint16_t w, uint16_t h, float Data[], int len, String title) {
-    float ymin;
-    float ymax;
-    int ticklines = 5;
-    int auto_scale_margin = 0;
-
-    int maxYscale = -10000;
-    int minYscale = 10000;
-
-    for (int i = 1; i < len; i++) {
-        if (Data[i] >= maxYscale) {
-            maxYscale = Data[i];
-        }
-        if (Data[i] <= minYscale) {
-            minYscale = Data[i];
-        }
-    }
-
-    maxYscale = round(maxYscale + auto_scale_margin); // Auto scale the graph and round to the nearest value defined, default was Y1Max
-    ymax = round(maxYscale + 0.5);
-    if (minYscale != 0) {
-        minYscale = round(minYscale - auto_scale_margin); // Auto scale the graph and round to the nearest value defined, default was Y1Min
-    }
-    ymin = round(minYscale);
-
-    float steps = (ymax - ymin) / (ticklines);
-
-    // Title
-    display.setFont();
-    drawString(x + w / 2, y - 24, title, CENTER);
+    for (int i = 0; i < ticklines + 1; i++) {
+        char label[12];
+        int ly = y + (h / ticklines) * i;
 
-    // Draw y-axis tick markers and dashed lines
-    for (byte i = 0; i < ticklines + 1; i++) {
         // Due to space constraints only show values under 10 with a decimal point
         if (ymin < 1 && ymax < 10) {
-            drawString(x - 2, y + ((h / ticklines) * i - 12), String(ymin + steps * (ticklines - i), 1), RIGHT);
+            snprintf(label, sizeof(label), "%.1f", ymin + steps * (ticklines - i));
         } else {
-            drawString(x - 2, y + ((h / ticklines) * i - 12), String(lrint(ymin + steps * (ticklines - i))), RIGHT);
+            snprintf(label, sizeof(label), "%ld", lrint(ymin + steps * (ticklines - i)));
         }
+        drawString(x - 2, ly - 12, label, RIGHT);
 
         if (i == 0) {
             continue;
         }
-
-        display.drawLine(x + 1, y + ((h / ticklines) * i), x + w - 1, y + ((h / ticklines) * i), GxEPD_RED);
-        bool blank = true;
-        for (byte r = 0; r < w; r = r + 3) {
-            if (blank) {
-                display.drawLine(x + r, y + ((h / ticklines) * i), x + r + 3, y + ((h / ticklines) * i), GxEPD_WHITE);
-                blank = false;
-            } else {
-                blank = true;
-            }
+        // 2 pixel dashes every 6 pixels
+        for (int r = 4; r < w; r += 6) {
+            frame.drawFastHLine(x + r, ly, min(2, w - r), GxEPD_RED);
         }
     }
 
     // x-Axis
-    display.drawLine(x, y + h, x + w, y + h, GxEPD_BLACK);
+    frame.drawFastHLine(x, y + h, w + 1, GxEPD_BLACK);
 
     // y-Axis
-    display.drawLine(x, y, x, y + h, GxEPD_BLACK);
-
-    // Draw data line 1
-    float x1 = x + 1;
-    float y1 = y + (ymax - constrain(Data[0], ymin, ymax)) / (ymax - ymin) * h;
-    float x2, y2;
+    frame.drawFastVLine(x, y, h + 1, GxEPD_BLACK);
 
-    if (y1 > y + h - 1) {
-        y1 = y + h - 1;
-    }
+    // Data, areas first
+    for (int pass = GRAPH_AREA; pass >= GRAPH_LINE; pass--) {
+        for (int s = 0; s < count; s++) {
+            if (series[s].style != pass) {
+                continue;
+            }
 
-    // Draw data on display
-    for (int i = 1; i < len; i++) {
-        x2 = x + i * w / (len - 1) - 1;
-        y2 = y + (ymax - constrain(Data[i], ymin, ymax)) / (ymax - ymin) * h + 1;
-        if (y2 > y + h - 1) {
-            y2 = y + h - 1;
+            int x1 = x + 1;
+            int y1 = 0;
+            for (int i = 0; i < len; i++) {
+                int x2 = i == 0 ? x1 : x + i * w / (len - 1) - 1;
+                float v = series[s][i];
+                v = isnan(v) ? ymin : constrain(v, ymin, ymax);
+                int y2 = min(y + (int)((ymax - v) * scale) + 1, y + h - 1);
+
+                if (i == 0) {
+                    y1 = y2;
+                    continue;
+                }
+                if (pass == GRAPH_AREA) {
+                    // One span per column from the line down to the x-axis
+                    frame.drawLine(x1, y1, x2, y2, GxEPD_RED);
+                    for (int cx = x1; cx <= x2; cx++) {
+                        int cy = x2 == x1 ? y2 : y1 + (y2 - y1) * (cx - x1) / (x2 - x1);
+                        frame.drawFastVLine(cx, cy, y + h - cy, GxEPD_RED);
+                    }
+                } else {
+                    // More solid line using 2 lines 1 pixel apart.
+                    frame.drawLine(x1, y1 - 1, x2, y2 - 1, GxEPD_BLACK);
+                    frame.drawLine(x1, y1, x2, y2, GxEPD_BLACK);
+                }
+                x1 = x2;
+                y1 = y2;
+            }
         }
-        // More solid line using 2 lines 1 pixel apart.
-        display.drawLine(x1, y1 - 1, x2, y2 - 1, GxEPD_BLACK);
-        display.drawLine(x1, y1, x2, y2, GxEPD_BLACK);
-
-        x1 = x2;
-        y1 = y2;
     }
 
-    // x-Axis ticks
-    // for (int i = 0; i <= 6; i++) {             // 72 hours
-    //   display.setCursor(x-7+(w/6)*i ,y+h+6);
+    // x-Axis ticks, hours from now
     for (int i = 0; i <= 4; i++) {
-        if (i == 0) {
-            display.setCursor(x - 5 + (w / 4) * i, y + h + 6);
-        } else {
-            display.setCursor(x - 7 + (w / 4) * i, y + h + 6);
-        }
-        display.print(String(12 * i));
-    }
-    // if (i == 0) {   // day 0 (now)
-    //   display.print("0");
-    // } else if ((12 * i) == 24) {   // day 1
-    //   display.print("24");
-    // } else if ((12 * i) == 48) {  // day 2
-    //   display.print("48");
-    // } else if ((12 * i) == 72) {  // day 3
-    //   display.print("72");
-    // }
+        frame.setCursor(x - (i == 0 ? 5 : 7) + (w / 4) * i, y + h + 6);
+        frame.print(12 * i);
+    }
 
     // Reset font
-    display.setFont(&DejaVu_Sans_Bold_11);
+    frame.setFont(&DejaVu_Sans_Bold_11);
 }
 
 /**
@@ -2305,23 +3737,23 @@ void drawSingleGraph(uint16_t x, uint16_t y, uint16_t w, uint16_t h, float Data[
  * 
  * @param x Display x coordinates
  * @param y Display y coordinates
- * @param text Test to display
+ * @param text Text to display
  * @param align Text alignment on the screen
  */
-void drawString(int x, int y, String text, alignment align) {
-    int16_t x1, y1; // the bounds of x,y and w and h of the variable 'text' in pixels.
-    uint16_t w, h;
-
-    display.setTextWrap(false);
-    display.getTextBounds(text, x, y, &x1, &y1, &w, &h);
-    if (align == RIGHT) {
-        x = x - w;
-    }
+void drawString(int x, int y, const char *text, alignment align) {
+    static const TextAlign text_align[] = {TEXT_LEFT, TEXT_RIGHT, TEXT_CENTER}; // by alignment
 
-    if (align == CENTER) {
-        x = x - w / 2;
-    }
+    frame.drawText(x, y, text, text_align[align]);
+}
 
-    display.setCursor(x, y + h);
-    display.print(text);
+/**
+ * @brief Draw a String to the screen, see drawString(int, int, const char *, alignment)
+ * 
+ * @param x Display x coordinates
+ * @param y Display y coordinates
+ * @param text Text to display
+ * @param align Text alignment on the screen
+ */
+void drawString(int x, int y, const String &text, alignment align) {
+    drawString(x, y, text.c_str(), align);
 }
\ No newline at end of file
@@ -0,0 +1,265 @@
+/* The TextCanvas library (consisting of textCanvas.h and textCanvas.cpp) extends GFXcanvas1 with text measurement
+    that works on const char* and reads only the glyph metrics of the current font, instead of running the full
+    getTextBounds() layout, and with drawText(), which lays out, aligns and draws a line of text in one walk over its
+    glyphs. The sizes of recently measured strings can be kept in a TextWidthCache (e.g. in RTC memory), so labels
+    that are drawn on every render are measured once and then only drawn.
+*/
+
+#include <Arduino.h>
+#include "textCanvas.h"
+
+/* TextCanvas::TextCanvas()
+    Class object constructor, sizes are not cached until setWidthCache() is called
+  Parameters:
+    uint16_t w, h: canvas size in pixels
+  Returns: None
+*/
+TextCanvas::TextCanvas(uint16_t w, uint16_t h) : GFXcanvas1(w, h) {
+  cache = NULL;
+}
+
+/* TextCanvas::setWidthCache()
+    Remember the sizes of measured strings in the given cache. Entries are keyed by the font pointer, so a cache
+    kept across deep sleep stays valid as long as the firmware doesn't change (it is reset on power up).
+  Parameters:
+    TextWidthCache *cache: cache to use, NULL = measure every time
+  Returns: None
+*/
+void TextCanvas::setWidthCache(TextWidthCache *cache) {
+  this->cache = cache;
+}
+
+/* TextCanvas::measureText()
+    Size of a string in the current font and text size, the same w and h getTextBounds() returns for text without
+    wrapping.
+  Parameters:
+    const char *text: string to measure
+    uint16_t *w, *h: width and height of the string in pixels, 0 for an empty string
+  Returns: None
+*/
+void TextCanvas::measureText(const char *text, uint16_t *w, uint16_t *h) {
+  size_t len = strcspn(text, "\n");
+  uint32_t key;
+
+  if (text[len] != '\0') {      // multi line text wraps back to x = 0, leave that to Adafruit_GFX
+    int16_t x1, y1;
+    getTextBounds(text, 0, 0, &x1, &y1, w, h);
+    return;
+  }
+  if (cachedSize(text, len, &key, w, h))
+    return;
+  glyphBounds(text, w, h);
+  cacheSize(text, len, key, *w, *h);
+}
+
+/* TextCanvas::drawText()
+    Draw a line of text with the top of its tallest glyph at y, like measuring it and printing it from
+    setCursor(x, y + h) would. A string whose size is cached is drawn in one walk over its glyphs. Any other is
+    laid out in one walk, which measures it and notes where each glyph goes, and then drawn from that layout: its
+    height is needed before the first glyph can be placed, whatever the alignment. Wrapped or multi line text and
+    strings longer than TEXT_LAYOUT_MAX are measured and printed.
+  Parameters:
+    int16_t x, y: where the text goes
+    const char *text: string to draw
+    TextAlign align: which point of the text is put at x
+  Returns: None
+*/
+void TextCanvas::drawText(int16_t x, int16_t y, const char *text, TextAlign align) {
+  int16_t pen[TEXT_LAYOUT_MAX + 1];   // x of each glyph drawn from the start of the string, INT16_MIN = none
+  size_t len = strcspn(text, "\n");
+  int16_t end;
+  uint32_t key;
+  uint16_t w, h;
+  bool laid_out = false;
+
+  if (wrap || text[len] != '\0' || len > TEXT_LAYOUT_MAX) {
+    measureText(text, &w, &h);
+    x = (align == TEXT_RIGHT ? x - w : align == TEXT_CENTER ? x - w / 2 : x);
+    setCursor(x, y + h);
+    print(text);
+    return;
+  }
+
+  if (!cachedSize(text, len, &key, &w, &h)) {
+    glyphBounds(text, &w, &h, pen);
+    cacheSize(text, len, key, w, h);
+    laid_out = true;
+  }
+  x = (align == TEXT_RIGHT ? x - w : align == TEXT_CENTER ? x - w / 2 : x);
+  y += h;                     // baseline
+
+  if (laid_out) {
+    for (size_t i = 0; i < len; i++) {
+      if (pen[i] != INT16_MIN)
+        drawGlyph(x + pen[i], y, text[i]);
+    }
+    end = pen[len];
+  } else {
+    end = 0;
+    for (size_t i = 0; i < len; i++) {
+      int16_t advance;
+      if (glyphAt(text[i], &advance))
+        drawGlyph(x + end, y, text[i]);
+      end += advance;
+    }
+  }
+  setCursor(x + end, y);      // where print() would have left it
+}
+
+/* TextCanvas::drawGlyph()
+    Draw one character at the cursor position write() would draw it at, in the current font, size and colours
+  Parameters:
+    int16_t x, y: cursor position
+    uint8_t c: character
+  Returns: None
+*/
+void TextCanvas::drawGlyph(int16_t x, int16_t y, uint8_t c) {
+  drawChar(x, y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+}
+
+/* TextCanvas::cachedSize()
+    Look a string up in the cache. An entry only counts as a hit if the length and first characters of its string
+    match too, so two strings with the same hash can't take each other's size.
+  Parameters:
+    const char *text: string to look up
+    size_t len: its length
+    uint32_t *key: its hash, for cacheSize()
+    uint16_t *w, *h: the cached size on a hit
+  Returns:
+    bool: true on a hit
+*/
+bool TextCanvas::cachedSize(const char *text, size_t len, uint32_t *key, uint16_t *w, uint16_t *h) {
+  if (cache == NULL || len > UINT16_MAX)
+    return false;
+
+  *key = textKey(text, len);
+  auto &entry = cache->entries[*key & (TEXT_CACHE_ENTRIES - 1)];
+  if (entry.key != *key || entry.len != len || strncmp(entry.prefix, text, sizeof(entry.prefix)) != 0)
+    return false;
+  *w = entry.w;
+  *h = entry.h;
+  cache->hits++;
+  return true;
+}
+
+/* TextCanvas::cacheSize()
+    Remember the size of a string that missed the cache
+  Parameters:
+    const char *text: string measured
+    size_t len: its length
+    uint32_t key: its hash from cachedSize()
+    uint16_t w, h: its size
+  Returns: None
+*/
+void TextCanvas::cacheSize(const char *text, size_t len, uint32_t key, uint16_t w, uint16_t h) {
+  if (cache == NULL || len > UINT16_MAX)
+    return;
+
+  auto &entry = cache->entries[key & (TEXT_CACHE_ENTRIES - 1)];
+  entry.key = key;
+  entry.w = w;
+  entry.h = h;
+  entry.len = len;
+  strncpy(entry.prefix, text, sizeof(entry.prefix));
+  cache->misses++;
+}
+
+/* TextCanvas::textKey()
+    FNV-1a hash of the current font, text size and the string, including its length
+  Parameters:
+    const char *text: string to hash
+    size_t len: its length
+  Returns:
+    uint32_t: hash, never 0 (marks an unused cache entry)
+*/
+uint32_t TextCanvas::textKey(const char *text, size_t len) {
+  uint32_t key = 2166136261u;
+  uint32_t font = (uint32_t)(uintptr_t)gfxFont;
+
+  for (uint8_t i = 0; i < 4; i++) {
+    key = (key ^ ((font >> (8 * i)) & 0xff)) * 16777619u;
+  }
+  key = (key ^ textsize_x) * 16777619u;
+  key = (key ^ textsize_y) * 16777619u;
+  for (size_t i = 0; i < len; i++) {
+    key = (key ^ (uint8_t)text[i]) * 16777619u;
+  }
+  key = (key ^ (uint8_t)len) * 16777619u;
+  return key ? key : 1;
+}
+
+/* TextCanvas::glyphAt()
+    Whether write() draws a character and how far it moves the cursor, with wrapping off
+  Parameters:
+    uint8_t c: character, not '\n'
+    int16_t *advance: how far the cursor moves on
+  Returns:
+    bool: true if the character is drawn
+*/
+bool TextCanvas::glyphAt(uint8_t c, int16_t *advance) {
+  *advance = 0;
+  if (c == '\r')
+    return false;
+  if (gfxFont == NULL) {      // built in 6x8 font
+    *advance = textsize_x * 6;
+    return true;
+  }
+  if (c < gfxFont->first || c > gfxFont->last)
+    return false;
+
+  const GFXglyph *glyph = &gfxFont->glyph[c - gfxFont->first];
+  *advance = glyph->xAdvance * textsize_x;
+  return glyph->width > 0 && glyph->height > 0;
+}
+
+/* TextCanvas::glyphBounds()
+    Walk the glyph metrics of a single line of text once and return its bounding box, following the rules of
+    Adafruit_GFX::charBounds() with wrapping off. Optionally notes where each glyph goes while at it.
+  Parameters:
+    const char *text: string to measure, no '\n'
+    uint16_t *w, *h: width and height of the string in pixels, 0 for an empty string
+    int16_t *pen: x of each character write() draws from the start of the string (INT16_MIN for the others), and
+      where the cursor ends up after the last, strlen(text) + 1 entries, NULL = don't
+  Returns: None
+*/
+void TextCanvas::glyphBounds(const char *text, uint16_t *w, uint16_t *h, int16_t *pen) {
+  int16_t minx = INT16_MAX, miny = INT16_MAX, maxx = INT16_MIN, maxy = INT16_MIN;
+  int16_t x = 0;
+  size_t i;
+  uint8_t c;
+
+  for (i = 0; (c = text[i]); i++) {
+    if (pen != NULL)
+      pen[i] = INT16_MIN;
+    if (c == '\r')
+      continue;
+    if (gfxFont == NULL) {    // built in 6x8 font
+      if (pen != NULL)
+        pen[i] = x;
+      minx = min(minx, x);
+      miny = 0;
+      maxx = max(maxx, (int16_t)(x + textsize_x * 6 - 1));
+      maxy = max(maxy, (int16_t)(textsize_y * 8 - 1));
+      x += textsize_x * 6;
+      continue;
+    }
+    if (c < gfxFont->first || c > gfxFont->last)
+      continue;
+
+    const GFXglyph *glyph = &gfxFont->glyph[c - gfxFont->first];
+    int16_t x1 = x + glyph->xOffset * textsize_x;
+    int16_t y1 = glyph->yOffset * textsize_y;
+    if (pen != NULL && glyph->width > 0 && glyph->height > 0)
+      pen[i] = x;
+    minx = min(minx, x1);
+    miny = min(miny, y1);
+    maxx = max(maxx, (int16_t)(x1 + glyph->width * textsize_x - 1));
+    maxy = max(maxy, (int16_t)(y1 + glyph->height * textsize_y - 1));
+    x += glyph->xAdvance * textsize_x;
+  }
+  if (pen != NULL)
+    pen[i] = x;
+
+  *w = maxx >= minx ? maxx - minx + 1 : 0;
+  *h = maxy >= miny ? maxy - miny + 1 : 0;
+}
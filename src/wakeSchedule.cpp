@@ -0,0 +1,65 @@
+/* The WakeSchedule library (consisting of wakeSchedule.h and wakeSchedule.cpp) works out when the monitor should wake
+    next: just after the next publication of a data source whose cache will have run out, but not before the interval
+    of the SleepPolicy for the time of day has passed. It also corrects the clock for the learned drift of the RTC.
+    Everything it needs is passed in, it reads no globals, so the schedule can be unit tested on the host
+    ([env:native], test/test_wake_schedule).
+*/
+
+#include "wakeSchedule.h"
+
+/* nextWakeTime()
+    Time to wake at next. The interval of the current policy is the earliest wake, a policy with a shorter interval
+    starting before then ends the interval at its start. From there each source is due once its ttl has run out, and
+    is woken for at its first publication after that, the earliest of the sources wins.
+  Parameters:
+    time_t now: unix time
+    const struct tm &local: now as local time, picks the policy
+    const SleepPolicy policies[], int policy_count: wake policies of the day, sorted by from_hour
+    const CacheStruct cache[], const CacheSource sources[], int source_count: the cached sources
+  Returns:
+    time_t: unix time to wake at
+*/
+time_t nextWakeTime(time_t now, const struct tm &local, const SleepPolicy policies[], int policy_count,
+                    const CacheStruct cache[], const CacheSource sources[], int source_count) {
+  int policy = policy_count - 1;    // before the first start hour the last policy is still running
+  for (int i = 0; i < policy_count; i++) {
+    if (local.tm_hour >= policies[i].from_hour)
+      policy = i;
+  }
+
+  time_t earliest = now + policies[policy].interval * 60;
+
+  const SleepPolicy &next = policies[(policy + 1) % policy_count];
+  int hours = (next.from_hour - local.tm_hour + 23) % 24 + 1;
+  time_t next_start = now + hours * 3600 - local.tm_min * 60 - local.tm_sec;
+  if (next.interval < policies[policy].interval && next_start < earliest)
+    earliest = next_start;
+
+  time_t wake = 0;
+  for (int i = 0; i < source_count; i++) {
+    const CacheSource &src = sources[i];
+    time_t due = earliest;
+    if ((time_t)(cache[i].fetched + src.ttl) > due)
+      due = cache[i].fetched + src.ttl;
+
+    time_t published = ((due - src.delay + src.period - 1) / src.period) * src.period + src.delay;
+    if (wake == 0 || published < wake)
+      wake = published;
+  }
+  return wake;
+}
+
+/* correctedTime()
+    Where the clock actually is, going by the drift of the RTC since the clock was last set.
+  Parameters:
+    double clock: time the RTC shows, unix time with fractions
+    time_t clock_ref: time the clock was last set, 0 = unknown (no correction)
+    float drift_ppm: real time gained on the RTC per 10^6 s, > 0 = RTC slow
+  Returns:
+    double: the corrected unix time
+*/
+double correctedTime(double clock, time_t clock_ref, float drift_ppm) {
+  if (clock_ref == 0 || clock <= clock_ref)
+    return clock;
+  return clock + (clock - clock_ref) * drift_ppm / 1e6;
+}
@@ -0,0 +1,106 @@
+/* Cost of the forecast layout on the host: a min/max scan of the pressure and temperature of the fixture forecast
+    (loadRenderFixture()) over the ForecastStore columns the firmware keeps, against the same scan over an array of
+    WeatherStruct, the layout before. Both scans have to find the same values, the times are printed only:
+
+    pio test -e native -f test_forecast_layout -v
+*/
+
+#include <Arduino.h>
+#include <unity.h>
+#include "weatherData.h"
+
+extern ForecastStore forecast;
+void loadRenderFixture(void);
+
+const int ROUNDS = 100000;              // scans timed in a row...
+const int RUNS = 5;                     // ...the fastest of these runs counts, timing on a PC is noisy
+
+static WeatherStruct rows[forecast_counter];
+
+  // Each round loads its data pointer through these, so the compiler can't assume a round scans the same data as
+  // the last one and hoist the scan out of the rounds loop
+static WeatherStruct *volatile rows_ref = rows;
+static const ForecastStore *volatile columns_ref = &forecast;
+static volatile float sink;             // keeps the scans from being optimised away
+
+typedef struct Scan {
+  float lo;
+  float hi;
+  uint32_t us;          // ROUNDS scans, fastest run
+} Scan;
+
+static Scan scanRows(void) {
+  Scan scan = {INFINITY, -INFINITY, UINT32_MAX};
+
+  for (int run = 0; run < RUNS; run++) {
+    uint32_t start = micros();
+    for (int r = 0; r < ROUNDS; r++) {
+      const WeatherStruct *row = rows_ref;
+      float lo = INFINITY;
+      float hi = -INFINITY;
+      for (int i = 0; i < forecast_counter; i++) {
+        lo = min(lo, min(row[i].pressure, row[i].temperature));
+        hi = max(hi, max(row[i].pressure, row[i].temperature));
+      }
+      sink = sink + lo + hi;
+      scan.lo = lo;
+      scan.hi = hi;
+    }
+    uint32_t us = micros() - start;
+    scan.us = min(scan.us, us);
+  }
+  return scan;
+}
+
+static Scan scanColumns(void) {
+  Scan scan = {INFINITY, -INFINITY, UINT32_MAX};
+
+  for (int run = 0; run < RUNS; run++) {
+    uint32_t start = micros();
+    for (int r = 0; r < ROUNDS; r++) {
+      const ForecastStore *columns = columns_ref;
+      float lo = INFINITY;
+      float hi = -INFINITY;
+      for (int i = 0; i < forecast_counter; i++) {
+        lo = min(lo, min(columns->pressure[i], columns->temperature[i]));
+        hi = max(hi, max(columns->pressure[i], columns->temperature[i]));
+      }
+      sink = sink + lo + hi;
+      scan.lo = lo;
+      scan.hi = hi;
+    }
+    uint32_t us = micros() - start;
+    scan.us = min(scan.us, us);
+  }
+  return scan;
+}
+
+void test_forecast_layout(void) {
+  loadRenderFixture();
+  for (int i = 0; i < forecast_counter; i++) {
+    rows[i] = WeatherStruct();
+    rows[i].pressure = forecast.pressure[i];
+    rows[i].temperature = forecast.temperature[i];
+  }
+
+  Scan by_rows = scanRows();
+  Scan by_columns = scanColumns();
+
+  printf("Forecast min/max of %d entries x%d, best of %d:\n", forecast_counter, ROUNDS, RUNS);
+  printf("  array of WeatherStruct  %8lu us  %5u bytes\n", (unsigned long)by_rows.us,
+         (unsigned)(forecast_counter * sizeof(WeatherStruct)));
+  printf("  ForecastStore columns   %8lu us  %5u bytes\n", (unsigned long)by_columns.us, (unsigned)sizeof(ForecastStore));
+
+  TEST_ASSERT_EQUAL_FLOAT(by_rows.lo, by_columns.lo);
+  TEST_ASSERT_EQUAL_FLOAT(by_rows.hi, by_columns.hi);
+  TEST_ASSERT_TRUE_MESSAGE(by_columns.lo < by_columns.hi, "the fixture forecast is empty");
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_forecast_layout);
+  return UNITY_END();
+}
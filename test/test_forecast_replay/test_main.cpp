@@ -0,0 +1,200 @@
+/* Replay of OpenWeatherMap forecast payloads of cnt=8..40 through getWeatherForecast() on the scripted network of
+    [env:native], gzip encoded like the API sends them, on a session set up like fetchOpenWeatherMap() does (the
+    gzip window reserved, the request sent). Prints the parse time and the heap the parse takes at its peak for
+    each cnt:
+
+    pio test -e native -f test_forecast_replay -v
+
+    The payloads are made from the recorded cnt=24 forecast of gzipFixtures.h, entries past the 24 recorded
+    repeat them three days later. The document is sized at compile time for FORECAST_API_COUNT (24)
+    entries, the payloads up to that have to parse with the same peak heap, a longer one may run out of room
+    (NoMemory), which the table shows but doesn't fail on.
+*/
+
+#include <Arduino.h>
+#include <unity.h>
+#include <zlib.h>
+#include "gzipFixtures.h"
+#include "gzipStream.h"
+#include "hostHeap.h"
+#include "hostNet.h"
+#include "httpsSession.h"
+
+bool getWeatherForecast(HttpsSession &http, GzipStream &gunzip, const HttpValidator *known);
+
+const char *const HOST = "api.openweathermap.org";
+const int RECORDED_COUNT = 24;          // entries of gzip_forecast_fixture
+const int API_COUNT = 24;               // FORECAST_API_COUNT of main.cpp
+const int MAX_COUNT = 40;               // most the API returns
+const int REPLAYS = 5;                  // the fastest of these counts, timing on a PC is noisy
+const uint32_t PERIOD = 3 * 3600;       // between forecast entries
+
+static char recorded[16 * 1024];        // the inflated fixture
+static const char *entries[RECORDED_COUNT];   // each entry of its list
+static size_t entry_len[RECORDED_COUNT];
+static const char *list_end;            // "]" closing the list, the rest of the payload follows it
+
+static char payload[28 * 1024];
+static uint8_t response[8 * 1024];
+
+typedef struct Replay {
+  int count;
+  bool ok;
+  size_t json;          // payload bytes
+  size_t body;          // gzip encoded bytes
+  uint32_t us;
+  size_t peak;          // heap at the peak of the parse, on top of what was in use before it
+  uint32_t allocations;
+} Replay;
+
+static bool inflateFixture(void) {
+  z_stream z = {};
+  if (inflateInit2(&z, 16 + MAX_WBITS) != Z_OK)
+    return false;
+  z.next_in = (Bytef *)gzip_forecast_fixture;
+  z.avail_in = sizeof(gzip_forecast_fixture);
+  z.next_out = (Bytef *)recorded;
+  z.avail_out = sizeof(recorded) - 1;
+  int ret = inflate(&z, Z_FINISH);
+  recorded[z.total_out] = '\0';
+  inflateEnd(&z);
+  return ret == Z_STREAM_END && z.total_out == gzip_forecast_inflated;
+}
+
+  // Find the entries of the list, each starts with "{"dt":" and no nested object does
+static bool splitEntries(void) {
+  const char *p = strstr(recorded, "\"list\":[");
+  list_end = strstr(recorded, "],\"city\"");
+  if (p == NULL || list_end == NULL)
+    return false;
+  p += strlen("\"list\":[");
+  for (int i = 0; i < RECORDED_COUNT; i++) {
+    const char *next = strstr(p + 1, ",{\"dt\":");
+    if (next == NULL || next > list_end)
+      next = list_end;
+    entries[i] = p;
+    entry_len[i] = next - p;
+    p = next + 1;
+  }
+  return entries[RECORDED_COUNT - 1] + entry_len[RECORDED_COUNT - 1] == list_end;
+}
+
+/* buildPayload()
+    The forecast as the API would send it for cnt=count
+  Returns:
+    size_t: length of payload
+*/
+static size_t buildPayload(int count) {
+  size_t len = snprintf(payload, sizeof(payload), "{\"cod\":\"200\",\"message\":0,\"cnt\":%d,\"list\":[", count);
+
+  for (int i = 0; i < count; i++) {
+    const char *entry = entries[i % RECORDED_COUNT];
+    unsigned long dt = strtoul(entry + strlen("{\"dt\":"), NULL, 10) + (i / RECORDED_COUNT) * RECORDED_COUNT * PERIOD;
+    const char *rest = strchr(entry, ',');
+    size_t rest_len = entry_len[i % RECORDED_COUNT] - (rest - entry);
+    len += snprintf(payload + len, sizeof(payload) - len, "%s{\"dt\":%lu%.*s", i ? "," : "", dt, (int)rest_len, rest);
+  }
+  len += snprintf(payload + len, sizeof(payload) - len, "%s", list_end);
+  return len;
+}
+
+/* buildResponse()
+    The HTTP response to a forecast request with the payload gzip encoded
+  Returns:
+    size_t: length of response, 0 if it doesn't fit
+*/
+static size_t buildResponse(size_t payload_len, size_t *body_len) {
+  static uint8_t body[sizeof(response)];
+  z_stream z = {};
+
+  if (deflateInit2(&z, 9, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    return 0;
+  z.next_in = (Bytef *)payload;
+  z.avail_in = payload_len;
+  z.next_out = body;
+  z.avail_out = sizeof(body);
+  int ret = deflate(&z, Z_FINISH);
+  *body_len = z.total_out;
+  deflateEnd(&z);
+  if (ret != Z_STREAM_END)
+    return 0;
+
+  int head = snprintf((char *)response, sizeof(response),
+                      "HTTP/1.1 200 OK\r\nContent-Type: application/json; charset=utf-8\r\n"
+                      "Content-Encoding: gzip\r\nContent-Length: %u\r\n\r\n", (unsigned)*body_len);
+  if (head + *body_len > sizeof(response))
+    return 0;
+  memcpy(response + head, body, *body_len);
+  return head + *body_len;
+}
+
+static Replay replay(int count) {
+  Replay r = {count, false, buildPayload(count), 0, UINT32_MAX, 0, 0};
+  size_t len = buildResponse(r.json, &r.body);
+
+  TEST_ASSERT_TRUE_MESSAGE(len > 0, "response buffer too small");
+  for (int i = 0; i < REPLAYS; i++) {
+    hostNetReset();
+    hostNetReply(HOST, response, len);
+
+    HttpsSession http(HOST);
+    GzipStream gunzip;
+    TEST_ASSERT_TRUE_MESSAGE(gunzip.reserve(), "no heap for the gzip window");
+    http.acceptGzip(true);
+    TEST_ASSERT_TRUE_MESSAGE(http.send("/data/2.5/forecast"), "request not sent");
+
+    hostHeapReset();
+    size_t before = hostHeapStats().in_use;
+    uint32_t start = micros();
+    bool ok = getWeatherForecast(http, gunzip, NULL);
+    uint32_t us = micros() - start;
+    HostHeapStats heap = hostHeapStats();
+
+    r.ok = ok;
+    r.us = min(r.us, us);
+    r.peak = heap.peak - before;
+    r.allocations = heap.allocations;
+    http.stop();
+  }
+  return r;
+}
+
+void test_forecast_replay(void) {
+  Replay replays[(MAX_COUNT - 8) / 8 + 1];
+  int n = 0;
+
+  TEST_ASSERT_TRUE_MESSAGE(inflateFixture(), "gzip_forecast_fixture doesn't inflate");
+  TEST_ASSERT_TRUE_MESSAGE(splitEntries(), "gzip_forecast_fixture isn't a forecast of 24 entries");
+
+  for (int count = 8; count <= MAX_COUNT; count += 8)
+    replays[n++] = replay(count);
+
+  printf("Forecast replay, gzip body, best of %d:\n", REPLAYS);
+  printf("  cnt   JSON bytes  gzip bytes  parse us  peak heap  allocations  result\n");
+  for (int i = 0; i < n; i++) {
+    const Replay &r = replays[i];
+    printf("  %3d   %10u  %10u  %8lu  %9u  %11lu  %s\n", r.count, (unsigned)r.json, (unsigned)r.body,
+           (unsigned long)r.us, (unsigned)r.peak, (unsigned long)r.allocations, r.ok ? "ok" : "FAILED");
+  }
+
+  for (int i = 0; i < n; i++) {
+    const Replay &r = replays[i];
+    char message[96];
+    if (r.count > API_COUNT)
+      continue;
+    snprintf(message, sizeof(message), "cnt=%d didn't parse", r.count);
+    TEST_ASSERT_TRUE_MESSAGE(r.ok, message);
+    snprintf(message, sizeof(message), "cnt=%d: %u bytes peak heap, %u for cnt=%d", r.count, (unsigned)r.peak,
+             (unsigned)replays[0].peak, replays[0].count);
+    TEST_ASSERT_TRUE_MESSAGE(r.peak == replays[0].peak, message);
+  }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_forecast_replay);
+  return UNITY_END();
+}
@@ -0,0 +1,94 @@
+/* Gzip encoded responses (Content-Encoding: gzip) on the scripted network of [env:native], read through
+    HttpsSession and GzipStream like the firmware reads them:
+      the OpenWeatherMap forecast of gzipFixtures.h parses through getWeatherForecast() and its filter
+      a body longer than the 32 KB window inflates to all of its bytes
+      the forecast with a broken crc32 in its gzip trailer is rejected by finish()
+
+    pio test -e native -f test_gzip -v
+*/
+
+#include <Arduino.h>
+#include <unity.h>
+#include "gzipFixtures.h"
+#include "gzipStream.h"
+#include "hostNet.h"
+#include "httpsSession.h"
+
+bool getWeatherForecast(HttpsSession &http, GzipStream &gunzip, const HttpValidator *known);
+Stream *responseBody(HttpsSession &http, GzipStream &gunzip);
+
+const char *const HOST = "api.openweathermap.org";
+const char *const PATH = "/data/2.5/forecast";
+
+static uint8_t response[4 * 1024];
+static GzipStream gunzip;
+
+/* queueResponse()
+    Queues a 200 response with body as its gzip encoded body
+  Returns:
+    bool: false if it doesn't fit in response
+*/
+static bool queueResponse(const uint8_t *body, size_t len) {
+  int head = snprintf((char *)response, sizeof(response),
+                      "HTTP/1.1 200 OK\r\nContent-Type: application/json; charset=utf-8\r\n"
+                      "Content-Encoding: gzip\r\nContent-Length: %u\r\n\r\n", (unsigned)len);
+  if (head + len > sizeof(response))
+    return false;
+  memcpy(response + head, body, len);
+  return hostNetReply(HOST, response, head + len);
+}
+
+  // Reads the whole body of the response to a request for PATH, returns the stream it was read from
+static Stream *readBody(HttpsSession &http) {
+  Stream *body = NULL;
+
+  http.acceptGzip(true);
+  if (http.get(PATH) && http.status == 200 && (body = responseBody(http, gunzip)) != NULL) {
+    while (body->read() >= 0)
+      ;
+  }
+  return body;
+}
+
+void test_forecast_parses(void) {
+  queueResponse(gzip_forecast_fixture, sizeof(gzip_forecast_fixture));
+  HttpsSession http(HOST);
+  http.acceptGzip(true);
+  http.send(PATH);
+
+  TEST_ASSERT_TRUE(getWeatherForecast(http, gunzip, NULL));
+}
+
+void test_window_wraps(void) {
+  queueResponse(gzip_window_fixture, sizeof(gzip_window_fixture));
+  HttpsSession http(HOST);
+  readBody(http);
+
+  TEST_ASSERT_EQUAL_UINT32(gzip_window_inflated, gunzip.inflated);
+}
+
+void test_broken_trailer_rejected(void) {
+  static uint8_t broken[sizeof(gzip_forecast_fixture)];
+  memcpy(broken, gzip_forecast_fixture, sizeof(broken));
+  broken[sizeof(broken) - 8] ^= 0x01;     // first byte of the crc32 in the trailer
+  queueResponse(broken, sizeof(broken));
+  HttpsSession http(HOST);
+  if (readBody(http) != &gunzip)
+    TEST_FAIL_MESSAGE("the response wasn't read as gzip");
+
+  TEST_ASSERT_FALSE(gunzip.finish());
+}
+
+void setUp(void) {
+  hostNetReset();
+}
+
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_forecast_parses);
+  RUN_TEST(test_window_wraps);
+  RUN_TEST(test_broken_trailer_rejected);
+  return UNITY_END();
+}
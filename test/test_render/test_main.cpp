@@ -0,0 +1,284 @@
+/* Render checks of [env:native]: renders every case of the check matrix (renderFixture.h) and compares it pixel
+    for pixel with its reference image in golden/, and its primitive count with golden/stats.txt. A render that
+    differs is written to out/<case>.png, with out/<case>_diff.png next to it showing the pixels that differ in
+    black. After an intended change of the render, record new references and commit them:
+
+    RENDER_RECORD=1 pio test -e native -f test_render
+
+    The render times in golden/stats.txt are those of the machine that recorded them and only checked when asked
+    for, on the machine that recorded them:
+
+    RENDER_TIMING=1 pio test -e native -f test_render
+*/
+
+#include <Arduino.h>
+#include <GxEPD2.h>
+#include <sys/stat.h>
+#include <unity.h>
+#include "hostPng.h"
+#include "renderFixture.h"
+
+void initialiseDisplay(void);
+void loadRenderFixture(void);
+void displayInformation(void);
+void displayErrorMessage(String message);
+void displayWifiErrorMessage(void);
+
+const uint16_t WIDTH = 400;
+const uint16_t HEIGHT = 300;
+const size_t FRAME_BYTES = WIDTH / 8 * HEIGHT;
+
+const int TIMED_RENDERS = 5;            // the fastest of these counts, timing on a PC is noisy
+const uint32_t PRIMITIVE_SLACK_PCT = 10; // % more primitives than recorded that counts as a regression
+const uint32_t TIME_SLACK_PCT = 25;     // % more time than recorded that counts as a regression...
+const uint32_t TIME_SLACK_US = 100;     // ...plus this much, a render takes about 100 us on a PC
+
+typedef struct RecordedStats {
+  char name[24];
+  uint32_t primitives;
+  uint32_t us;
+} RecordedStats;
+
+static RenderCase cases[RENDER_CASE_MAX];
+static char names[RENDER_CASE_MAX][24];
+static int case_count;
+static int current;               // case the running test checks
+static bool recording;
+static bool timing;               // check the render times too
+static RecordedStats recorded[RENDER_CASE_MAX];
+static int recorded_count;
+static uint8_t reference[FRAME_BYTES];
+
+/* testDir()
+    Path of a file in the directory of this test
+  Parameters:
+    char *path, size_t size: buffer for the path
+    const char *sub: subdirectory, golden or out
+    const char *name, const char *suffix: file name
+*/
+static void testDir(char *path, size_t size, const char *sub, const char *name, const char *suffix) {
+  const char *slash = strrchr(__FILE__, '/');
+  int dir_len = slash != NULL ? slash - __FILE__ + 1 : 0;
+
+  snprintf(path, size, "%.*s%s/%s%s", dir_len, __FILE__, sub, name, suffix);
+}
+
+  // File name of a case, e.g. icon_05 or wind_225
+static void caseName(const RenderCase &c, char *name, size_t size) {
+  static const char *const kinds[] = {"info", "icon", "cold", "wind", "battery", "error", "wifi_error"};
+
+  if (c.kind == CASE_INFO || c.kind == CASE_COLD || c.kind == CASE_ERROR)
+    snprintf(name, size, "%s", kinds[c.kind]);
+  else
+    snprintf(name, size, "%s_%02d", kinds[c.kind], c.value);
+}
+
+static void loadStats(void) {
+  char path[256];
+  testDir(path, sizeof(path), "golden", "stats", ".txt");
+  FILE *f = fopen(path, "r");
+
+  recorded_count = 0;
+  if (f == NULL)
+    return;
+  while (recorded_count < RENDER_CASE_MAX) {
+    RecordedStats &r = recorded[recorded_count];
+    unsigned long primitives, us;
+    if (fscanf(f, "%23s %lu %lu", r.name, &primitives, &us) != 3)
+      break;
+    r.primitives = primitives;
+    r.us = us;
+    recorded_count++;
+  }
+  fclose(f);
+}
+
+static const RecordedStats *findStats(const char *name) {
+  for (int i = 0; i < recorded_count; i++) {
+    if (strcmp(recorded[i].name, name) == 0)
+      return &recorded[i];
+  }
+  return NULL;
+}
+
+  // Render a case TIMED_RENDERS times, the result has the time of the fastest render
+static RenderResult renderTimed(const RenderCase &c) {
+  RenderResult result = renderCase(c);
+
+  for (int i = 1; i < TIMED_RENDERS; i++) {
+    RenderResult again = renderCase(c);
+    if (again.us < result.us)
+      result.us = again.us;
+  }
+  return result;
+}
+
+/* writeDiff()
+    Write the frame of a failed case and a diff image (differing pixels black) to out/
+  Returns:
+    uint32_t: number of pixels that differ
+*/
+static uint32_t writeDiff(const char *name, const uint8_t *actual) {
+  static uint8_t diff[FRAME_BYTES];
+  char path[256];
+  uint32_t differing = 0;
+
+  for (size_t i = 0; i < FRAME_BYTES; i++) {
+    uint8_t bits = actual[i] ^ reference[i];
+    diff[i] = ~bits;
+    differing += __builtin_popcount(bits);
+  }
+  testDir(path, sizeof(path), "out", "", "");
+  mkdir(path, 0755);
+  testDir(path, sizeof(path), "out", name, ".png");
+  hostWritePng(path, actual, WIDTH, HEIGHT);
+  testDir(path, sizeof(path), "out", name, "_diff.png");
+  hostWritePng(path, diff, WIDTH, HEIGHT);
+  return differing;
+}
+
+void test_render_case(void) {
+  const char *name = names[current];
+  RenderResult result = renderTimed(cases[current]);
+  char path[256];
+  char message[160];
+
+  testDir(path, sizeof(path), "golden", name, ".png");
+  if (recording) {
+    TEST_ASSERT_TRUE_MESSAGE(hostWritePng(path, result.frame, WIDTH, HEIGHT), path);
+    RecordedStats &r = recorded[recorded_count++];
+    snprintf(r.name, sizeof(r.name), "%s", name);
+    r.primitives = result.primitives;
+    r.us = result.us;
+    return;
+  }
+
+  const RecordedStats *expected = findStats(name);
+  snprintf(message, sizeof(message), "no reference for %s, record it with RENDER_RECORD=1", name);
+  TEST_ASSERT_TRUE_MESSAGE(hostReadPng(path, reference, WIDTH, HEIGHT) && expected != NULL, message);
+
+  if (memcmp(result.frame, reference, FRAME_BYTES) != 0) {
+    uint32_t differing = writeDiff(name, result.frame);
+    snprintf(message, sizeof(message), "%lu pixels differ, see test/test_render/out/%s_diff.png",
+             (unsigned long)differing, name);
+    TEST_FAIL_MESSAGE(message);
+  }
+
+  snprintf(message, sizeof(message), "%lu primitives, %lu recorded", (unsigned long)result.primitives,
+           (unsigned long)expected->primitives);
+  TEST_ASSERT_TRUE_MESSAGE(result.primitives * 100 <= expected->primitives * (100 + PRIMITIVE_SLACK_PCT), message);
+
+  if (!timing)
+    return;
+  snprintf(message, sizeof(message), "%lu us, %lu us recorded", (unsigned long)result.us, (unsigned long)expected->us);
+  TEST_ASSERT_TRUE_MESSAGE(result.us * 100 <= expected->us * (100 + TIME_SLACK_PCT) + TIME_SLACK_US * 100, message);
+}
+
+  // The display...() functions send the frame to the panel, which has to show the reference image afterwards
+static void checkPanel(const char *name) {
+  char path[256];
+  const GxEPD2_EPD *panel = GxEPD2_EPD::refreshed;
+
+  testDir(path, sizeof(path), "golden", name, ".png");
+  TEST_ASSERT_NOT_NULL_MESSAGE(panel, "panel not refreshed");
+  TEST_ASSERT_TRUE_MESSAGE(hostReadPng(path, reference, WIDTH, HEIGHT), path);
+  if (memcmp(panel->shown(), reference, FRAME_BYTES) != 0) {
+    char diff_name[32];
+    char message[160];
+    snprintf(diff_name, sizeof(diff_name), "panel_%s", name);
+    snprintf(message, sizeof(message), "%lu pixels differ on the panel, see test/test_render/out/%s_diff.png",
+             (unsigned long)writeDiff(diff_name, panel->shown()), diff_name);
+    TEST_FAIL_MESSAGE(message);
+  }
+}
+
+void test_panel_information(void) {
+  loadRenderFixture();
+  displayInformation();
+  checkPanel("info");
+}
+
+void test_panel_error(void) {
+  loadRenderFixture();
+  displayErrorMessage("Unable to retrieve data, contact support!");
+  checkPanel("error");
+}
+
+  // The battery is read here, the host ADC reads 3.9 V, so the reference is the render of that case
+void test_panel_wifi_error(void) {
+  displayWifiErrorMessage();
+  TEST_ASSERT_NOT_NULL_MESSAGE(GxEPD2_EPD::refreshed, "panel not refreshed");
+  memcpy(reference, GxEPD2_EPD::refreshed->shown(), FRAME_BYTES);
+
+  RenderResult expected = renderCase({CASE_WIFI_ERROR, 3900});
+  TEST_ASSERT_EQUAL_MEMORY(expected.frame, reference, FRAME_BYTES);
+}
+
+  // Icons from include/iconAtlas.h are copied into the frame without a draw primitive, so every weather icon
+  // renders with the same primitive count. An icon drawn procedurally adds its own, regenerate the atlas with
+  // pio run -e icon-atlas after changing an icon procedure.
+void test_icons_from_atlas(void) {
+  int first = -1;
+  uint32_t first_primitives = 0;
+
+  for (int i = 0; i < case_count; i++) {
+    if (cases[i].kind != CASE_ICON || cases[i].value == 0) // 0 = no icon, drawn as text
+      continue;
+    uint32_t primitives = renderCase(cases[i]).primitives;
+    if (first < 0) {
+      first = i;
+      first_primitives = primitives;
+      continue;
+    }
+    char message[128];
+    snprintf(message, sizeof(message), "%.23s: %lu primitives, %.23s: %lu, not drawn from the atlas", names[i],
+             (unsigned long)primitives, names[first], (unsigned long)first_primitives);
+    TEST_ASSERT_TRUE_MESSAGE(primitives == first_primitives, message);
+  }
+  TEST_ASSERT_TRUE_MESSAGE(first >= 0, "no icon cases");
+}
+
+static void saveStats(void) {
+  char path[256];
+  testDir(path, sizeof(path), "golden", "stats", ".txt");
+  FILE *f = fopen(path, "w");
+
+  if (f == NULL)
+    return;
+  for (int i = 0; i < recorded_count; i++)
+    fprintf(f, "%s %lu %lu\n", recorded[i].name, (unsigned long)recorded[i].primitives, (unsigned long)recorded[i].us);
+  fclose(f);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  recording = getenv("RENDER_RECORD") != NULL;
+  timing = getenv("RENDER_TIMING") != NULL;
+  case_count = buildRenderCases(cases);
+  for (int i = 0; i < case_count; i++)
+    caseName(cases[i], names[i], sizeof(names[i]));
+  if (recording) {
+    char path[256];
+    testDir(path, sizeof(path), "golden", "", "");
+    mkdir(path, 0755);
+  } else {
+    loadStats();
+  }
+
+  initialiseDisplay();
+
+  UNITY_BEGIN();
+  for (current = 0; current < case_count; current++)
+    UnityDefaultTestRun(test_render_case, names[current], __LINE__);
+  if (recording) {
+    saveStats();
+  } else {
+    RUN_TEST(test_panel_information);
+    RUN_TEST(test_panel_error);
+    RUN_TEST(test_panel_wifi_error);
+    RUN_TEST(test_icons_from_atlas);
+  }
+  return UNITY_END();
+}
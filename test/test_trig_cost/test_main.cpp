@@ -0,0 +1,218 @@
+/* Cost of the trigonometry of a render on the host, the float sin()/cos() the drawing helpers did before
+    fixedTrig.h against the table lookups they do now. Only the coordinates are worked out, nothing is drawn, so the
+    difference is the float math a render no longer does. The mix is that of the fixture frame (loadRenderFixture())
+    with its icons drawn by their procedures, as without include/iconAtlas.h:
+      the compass of displayWind(): 16 ticks and the wind arrow
+      the five forecast icons: 01d and 02d (addSun()), 10d (addRain(), 6 arrows), 13n (addSnow()), 11d (none)
+      the large icon, 04d: none
+    Prints the time per render both ways, fails only if the tables are the slower. Also checks the tables give the
+    coordinates the float math did.
+
+    pio test -e native -f test_trig_cost -v
+
+    The float versions are the old code, including the 3.14 of the sun and snow helpers.
+*/
+
+#include <Arduino.h>
+#include <unity.h>
+#include "fixedTrig.h"
+
+const int RENDERS = 20000;              // renders timed in a row...
+const int RUNS = 5;                     // ...the fastest of these runs counts, timing on a PC is noisy
+
+const int SMALL = 4;                    // icon scales of main.cpp
+const int LARGE = 10;
+const int COMPASS_RADIUS = 40;          // displayWind() of the fixture frame
+const int WIND_DEG = 235;
+const int RAIN_ARROWS = 6;              // addRain()
+
+  // sin() and cos() evaluations of the old helpers in one render: 2 per compass tick, sun ray and snow flake point,
+  // 14 per arrow
+const int FLOAT_TRIG_CALLS = 16 * 2 + (1 + RAIN_ARROWS) * 14 + 2 * 8 * 2 + 5 * 8 * 2;
+
+  // Read for every render, so the compiler can't work the results out at compile time
+static volatile int input_radius = COMPASS_RADIUS;
+static volatile int input_wind = WIND_DEG;
+static volatile int input_scale = SMALL;   // the forecast icons
+static volatile int sink;                  // keeps the results alive
+
+  // The old helpers, coordinates only
+static int floatCompass(int radius) {
+  int sum = 0;
+  for (float a = 0; a < 360; a = a + 22.5) {
+    int dxo = radius * cos((a - 90) * PI / 180);
+    int dyo = radius * sin((a - 90) * PI / 180);
+    sum += dxo + dyo;
+  }
+  return sum;
+}
+
+static int floatArrow(int x, int y, int asize, float aangle, int pwidth, int plength) {
+  float dx = (asize - 10) * cos((aangle - 90) * PI / 180) + x;
+  float dy = (asize - 10) * sin((aangle - 90) * PI / 180) + y;
+  float x1 = 0;
+  float y1 = plength;
+  float x2 = pwidth / 2;
+  float y2 = pwidth / 2;
+  float x3 = -pwidth / 2;
+  float y3 = pwidth / 2;
+  float angle = aangle * PI / 180 - 135;
+  float xx1 = x1 * cos(angle) - y1 * sin(angle) + dx;
+  float yy1 = y1 * cos(angle) + x1 * sin(angle) + dy;
+  float xx2 = x2 * cos(angle) - y2 * sin(angle) + dx;
+  float yy2 = y2 * cos(angle) + x2 * sin(angle) + dy;
+  float xx3 = x3 * cos(angle) - y3 * sin(angle) + dx;
+  float yy3 = y3 * cos(angle) + x3 * sin(angle) + dy;
+  return (int)xx1 + (int)yy1 + (int)xx2 + (int)yy2 + (int)xx3 + (int)yy3;
+}
+
+static int floatSun(int scale) {
+  int sum = 0;
+  for (float i = 0; i < 360; i = i + 45) {
+    int dxo = 2.2 * scale * cos((i - 90) * 3.14 / 180);
+    int dyo = 2.2 * scale * sin((i - 90) * 3.14 / 180);
+    sum += dxo + dyo;
+  }
+  return sum;
+}
+
+static int floatSnow(int scale) {
+  int sum = 0;
+  for (int flakes = 0; flakes < 5; flakes++) {
+    for (int i = 0; i < 360; i = i + 45) {
+      int dxo = 0.5 * scale * cos((i - 90) * 3.14 / 180);
+      int dyo = 0.5 * scale * sin((i - 90) * 3.14 / 180);
+      sum += dxo + dyo + flakes;
+    }
+  }
+  return sum;
+}
+
+  // The helpers as they are, coordinates only
+static int fixedCompass(int radius) {
+  int sum = 0;
+  for (int point = 0; point < 16; point++)
+    sum += trigMul(radius, compassSin(point)) - trigMul(radius, compassCos(point));
+  return sum;
+}
+
+static int fixedArrow(int x, int y, int asize, int aangle, int pwidth, int plength) {
+  int dx = trigMul(asize - 10, degSin(aangle)) + x;
+  int dy = -trigMul(asize - 10, degCos(aangle)) + y;
+  int xx1, yy1, xx2, yy2, xx3, yy3;
+
+  rotate(0, plength, aangle + 180, xx1, yy1);
+  rotate(pwidth / 2, pwidth / 2, aangle + 180, xx2, yy2);
+  rotate(-pwidth / 2, pwidth / 2, aangle + 180, xx3, yy3);
+  return xx1 + yy1 + xx2 + yy2 + xx3 + yy3 + 3 * (dx + dy);
+}
+
+static int fixedSun(int scale) {
+  int sum = 0;
+  for (int point = 0; point < 16; point += 2)
+    sum += trigMul(22 * scale, compassSin(point)) / 10 - trigMul(22 * scale, compassCos(point)) / 10;
+  return sum;
+}
+
+static int fixedSnow(int scale) {
+  int sum = 0;
+  for (int flakes = 0; flakes < 5; flakes++) {
+    for (int point = 0; point < 16; point += 2)
+      sum += trigMul(scale, compassSin(point)) / 2 - trigMul(scale, compassCos(point)) / 2 + flakes;
+  }
+  return sum;
+}
+
+  // The trig of one render, the old way and the current way
+static int floatRender(void) {
+  int radius = input_radius;
+  int scale = input_scale;
+  int sum = floatCompass(radius) + floatArrow(0, 0, radius - 11, input_wind, 15, 22);
+
+  sum += floatSun(scale * 1.5) + floatSun(scale);  // 01d, 02d
+  for (int i = 0; i < RAIN_ARROWS; i++)            // 10d
+    sum += floatArrow(scale * i * 1.3, 0, scale / 6, 40, scale / 1.6, scale * 1.2);
+  return sum + floatSnow(scale);                   // 13n
+}
+
+static int fixedRender(void) {
+  int radius = input_radius;
+  int scale = input_scale;
+  int sum = fixedCompass(radius) + fixedArrow(0, 0, radius - 11, input_wind, 15, 22);
+
+  sum += fixedSun(scale * 1.5) + fixedSun(scale);  // 01d, 02d
+  for (int i = 0; i < RAIN_ARROWS; i++)            // 10d
+    sum += fixedArrow(scale * i * 1.3, 0, scale / 6, 40, scale / 1.6, scale * 1.2);
+  return sum + fixedSnow(scale);                   // 13n
+}
+
+/* timeRenders()
+  Returns:
+    uint32_t: microseconds the fastest of RUNS runs of RENDERS renders took
+*/
+static uint32_t timeRenders(int (*render)(void)) {
+  uint32_t best = UINT32_MAX;
+
+  for (int run = 0; run < RUNS; run++) {
+    uint32_t start = micros();
+    for (int i = 0; i < RENDERS; i++)
+      sink = render();
+    uint32_t us = micros() - start;
+    best = min(best, us);
+  }
+  return best;
+}
+
+  // The tables give the coordinates the float math did, give or take the pixel the truncation rounds either way.
+  // The arrow isn't compared, the old one was turned by 185 degrees instead of 180.
+void test_fixed_matches_float(void) {
+  const int scales[] = {SMALL, SMALL * 3 / 2, LARGE, LARGE * 3 / 2};
+  char message[96];
+
+  for (int point = 0; point < 16; point++) {
+    float a = point * 22.5;
+    int dxo = COMPASS_RADIUS * cos((a - 90) * PI / 180);
+    int dyo = COMPASS_RADIUS * sin((a - 90) * PI / 180);
+    snprintf(message, sizeof(message), "compass point %d", point);
+    TEST_ASSERT_INT_WITHIN_MESSAGE(1, dxo, trigMul(COMPASS_RADIUS, compassSin(point)), message);
+    TEST_ASSERT_INT_WITHIN_MESSAGE(1, dyo, -trigMul(COMPASS_RADIUS, compassCos(point)), message);
+  }
+
+  for (int scale : scales) {
+    for (int point = 0; point < 16; point += 2) {
+      int i = point * 45 / 2;
+      int sun_x = 2.2 * scale * cos((i - 90) * 3.14 / 180);
+      int sun_y = 2.2 * scale * sin((i - 90) * 3.14 / 180);
+      int snow_x = 0.5 * scale * cos((i - 90) * 3.14 / 180);
+      int snow_y = 0.5 * scale * sin((i - 90) * 3.14 / 180);
+      snprintf(message, sizeof(message), "scale %d, %d degrees", scale, i);
+      TEST_ASSERT_INT_WITHIN_MESSAGE(1, sun_x, trigMul(22 * scale, compassSin(point)) / 10, message);
+      TEST_ASSERT_INT_WITHIN_MESSAGE(1, sun_y, -trigMul(22 * scale, compassCos(point)) / 10, message);
+      TEST_ASSERT_INT_WITHIN_MESSAGE(1, snow_x, trigMul(scale, compassSin(point)) / 2, message);
+      TEST_ASSERT_INT_WITHIN_MESSAGE(1, snow_y, -trigMul(scale, compassCos(point)) / 2, message);
+    }
+  }
+}
+
+void test_trig_cost(void) {
+  uint32_t float_us = timeRenders(floatRender);
+  uint32_t fixed_us = timeRenders(fixedRender);
+
+  printf("Trigonometry of a render, %d renders, best of %d:\n", RENDERS, RUNS);
+  printf("  float (sin/cos, %d calls)  %8.1f ns per render\n", FLOAT_TRIG_CALLS, float_us * 1000.0 / RENDERS);
+  printf("  fixed (fixedTrig.h)         %8.1f ns per render\n", fixed_us * 1000.0 / RENDERS);
+  printf("  removed                     %8.1f ns per render, %.1fx\n", ((double)float_us - fixed_us) * 1000.0 / RENDERS,
+         fixed_us ? (double)float_us / fixed_us : 0.0);
+
+  TEST_ASSERT_TRUE_MESSAGE(fixed_us < float_us, "the table lookups are slower than the float math");
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_fixed_matches_float);
+  RUN_TEST(test_trig_cost);
+  return UNITY_END();
+}
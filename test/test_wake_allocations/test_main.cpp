@@ -0,0 +1,288 @@
+/* Heap allocations of a whole wake on the host ([env:native-wake], the firmware without the render fixture):
+    setup() from power on with nothing cached, connecting to the wifi, fetching the weather, the forecast and the
+    water of the station of config_example.h from scripted responses, rendering and going to deep sleep. Each wake
+    runs in a child process, so it starts from the state of a power on and its deep sleep ends only the child.
+
+    pio test -e native-wake -v
+
+    The wake is run with two sets of data whose texts (descriptions, station and series names) differ in length.
+    With plain char buffers in WeatherStruct/WaterStruct both take the same allocations, which the test checks.
+    For comparison it prints what the String members the structs had before would have allocated on top for the
+    same data, 4 per weather (3 for the current one, the period is only set for forecasts) and 12 per station,
+    with the 11 character inline buffer the ESP32 String has.
+*/
+
+#include <Arduino.h>
+#include <GxEPD2.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <unity.h>
+#include "hostHeap.h"
+#include "hostNet.h"
+
+void setup(void);
+
+const char *const OWM_HOST = "api.openweathermap.org";
+const char *const WATER_HOST = "www.pegelonline.wsv.de";
+const int FORECAST_API_COUNT = 24;      // cnt= of FORECAST_URL in config_example.h
+const int FORECAST_COUNT = 16;          // forecast_counter of main.cpp, the forecasts the old structs kept
+const uint32_t FORECAST_START = 1725991200;   // 2024-09-10 18:00 UTC
+const int WAKE_REQUESTS = 6;            // weather, forecast, the station and its three series
+
+typedef struct WakeData {
+  const char *main;             // weather of now and of every forecast
+  const char *description;
+  const char *icon;
+  const char *station;
+  const char *longname[3];      // W, WT, Q
+  const char *unit[3];
+  const char *timestamp;
+  const char *state;            // stateMnwMhw and stateNswHsw of W
+} WakeData;
+
+const WakeData short_texts = {
+  "Clouds", "broken clouds", "04d", "KONSTANZ",
+  {"WASSERSTAND ROHDATEN", "WASSERTEMPERATUR", "ABFLUSS"}, {"cm", "°C", "m³/s"},
+  "2024-09-10T22:15:00+02:00", "normal"
+};
+
+const WakeData long_texts = {
+  "Thunderstorm", "thunderstorm with heavy rain", "11n", "RHEINFELDEN-SCHUSTERINSEL",
+  {"WASSERSTAND ROHDATEN", "WASSERTEMPERATUR ROHDATEN", "ABFLUSS ROHDATEN"}, {"cm", "°C", "m³/s"},
+  "2024-09-10T22:15:00+02:00", "normal"
+};
+
+typedef struct WakeReport {
+  uint32_t allocations;
+  size_t peak;                  // most heap in use during the wake, on top of what was in use before it
+  uint32_t requests;            // requests the scripted network answered
+  bool refreshed;               // the panel was refreshed
+  uint64_t sleep_us;            // timer of the deep sleep the wake ended with
+} WakeReport;
+
+  // The responses have to outlive the wake, hostNetReply() doesn't copy them
+static char responses[32 * 1024];
+static size_t responses_len;
+static int report_fd = -1;
+static size_t heap_before;
+
+static const char *addResponse(const char *body, size_t *len) {
+  char *response = responses + responses_len;
+  int n = snprintf(response, sizeof(responses) - responses_len,
+                   "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: %u\r\n\r\n%s",
+                   (unsigned)strlen(body), body);
+  TEST_ASSERT_TRUE_MESSAGE(n > 0 && (size_t)n < sizeof(responses) - responses_len, "responses don't fit");
+  responses_len += n + 1;
+  *len = n;
+  return response;
+}
+
+static void reply(const char *host, const char *body) {
+  size_t len;
+  const char *response = addResponse(body, &len);
+  TEST_ASSERT_TRUE_MESSAGE(hostNetReply(host, response, len), "reply not queued");
+}
+
+/* scriptWake()
+    Queue the responses of a wake for the given data, in the order the wake sends its requests
+*/
+static void scriptWake(const WakeData &d) {
+  static char body[24 * 1024];
+  size_t len;
+
+  hostNetReset();
+  responses_len = 0;
+
+  snprintf(body, sizeof(body),
+           "{\"coord\":{\"lon\":0,\"lat\":51.5},\"weather\":[{\"id\":803,\"main\":\"%s\",\"description\":\"%s\","
+           "\"icon\":\"%s\"}],\"base\":\"stations\",\"main\":{\"temp\":17.4,\"feels_like\":16.9,\"temp_min\":15.8,"
+           "\"temp_max\":19.2,\"pressure\":1012,\"humidity\":72},\"visibility\":10000,\"wind\":{\"speed\":4.1,"
+           "\"deg\":230,\"gust\":7.2},\"clouds\":{\"all\":75},\"dt\":1726000000,\"sys\":{\"sunrise\":1725946187,"
+           "\"sunset\":1725992883},\"timezone\":3600,\"name\":\"London\",\"cod\":200}",
+           d.main, d.description, d.icon);
+  reply(OWM_HOST, body);
+
+  len = snprintf(body, sizeof(body), "{\"cod\":\"200\",\"message\":0,\"cnt\":%d,\"list\":[", FORECAST_API_COUNT);
+  for (int i = 0; i < FORECAST_API_COUNT; i++) {
+    time_t dt = FORECAST_START + i * 3 * 3600;
+    char dt_txt[20];
+    strftime(dt_txt, sizeof(dt_txt), "%Y-%m-%d %H:%M:%S", gmtime(&dt));
+    len += snprintf(body + len, sizeof(body) - len,
+                    "%s{\"dt\":%lu,\"main\":{\"temp\":%.2f,\"feels_like\":%.2f,\"temp_min\":%.2f,\"temp_max\":%.2f,"
+                    "\"pressure\":1012,\"humidity\":70},\"weather\":[{\"id\":500,\"main\":\"%s\",\"description\":\"%s\","
+                    "\"icon\":\"%s\"}],\"clouds\":{\"all\":40},\"wind\":{\"speed\":3.2,\"deg\":200},\"dt_txt\":\"%s\"}",
+                    i ? "," : "", (unsigned long)dt, 16.0 + i % 8, 15.5 + i % 8, 15.0 + i % 8, 17.0 + i % 8,
+                    d.main, d.description, d.icon, dt_txt);
+  }
+  snprintf(body + len, sizeof(body) - len, "],\"city\":{\"id\":2643743,\"name\":\"London\",\"timezone\":3600}}");
+  reply(OWM_HOST, body);
+
+  snprintf(body, sizeof(body),
+           "{\"uuid\":\"66ff3eb4-513b-478b-abd2-2f5126ea66fd\",\"shortname\":\"%s\",\"longname\":\"%s\",\"timeseries\":["
+           "{\"shortname\":\"W\",\"longname\":\"%s\",\"unit\":\"%s\",\"currentMeasurement\":{\"timestamp\":\"%s\","
+           "\"value\":341.0,\"stateMnwMhw\":\"%s\",\"stateNswHsw\":\"%s\"}},"
+           "{\"shortname\":\"WT\",\"longname\":\"%s\",\"unit\":\"%s\",\"currentMeasurement\":{\"timestamp\":\"%s\","
+           "\"value\":19.4}},"
+           "{\"shortname\":\"Q\",\"longname\":\"%s\",\"unit\":\"%s\",\"currentMeasurement\":{\"timestamp\":\"%s\","
+           "\"value\":312.0}}]}",
+           d.station, d.station, d.longname[0], d.unit[0], d.timestamp, d.state, d.state, d.longname[1], d.unit[1],
+           d.timestamp, d.longname[2], d.unit[2], d.timestamp);
+  reply(WATER_HOST, body);
+
+  const float values[3] = {341.0, 19.4, 312.0};
+  for (int i = 0; i < 3; i++) {
+    snprintf(body, sizeof(body), "{\"timestamp\":\"%s\",\"value\":%.1f,\"stateMnwMhw\":\"%s\",\"stateNswHsw\":\"%s\"}",
+             d.timestamp, values[i], i == 0 ? d.state : "unknown", i == 0 ? d.state : "unknown");
+    reply(WATER_HOST, body);
+  }
+}
+
+  // atexit() handler of the wake, its deep sleep ends the child process
+static void reportWake(void) {
+  HostHeapStats heap = hostHeapStats();
+  WakeReport report = {heap.allocations, heap.peak - heap_before, hostNetRequests(), GxEPD2_EPD::refreshed != NULL,
+                       hostSleepTimer()};
+
+  if (write(report_fd, &report, sizeof(report)) != sizeof(report))
+    _exit(3);
+}
+
+/* runWake()
+    Run setup() from power on in a child process, with the responses for the given data
+  Returns:
+    bool: the wake ended in deep sleep and reported
+*/
+static bool runWake(const WakeData &d, WakeReport &report) {
+  int fds[2];
+
+  if (pipe(fds) != 0)
+    return false;
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(fds[0]);
+    report_fd = fds[1];
+    scriptWake(d);
+    atexit(reportWake);
+    hostHeapReset();
+    heap_before = hostHeapStats().in_use;
+    setup();
+    _exit(2);     // setup() ends in deep sleep, it doesn't return
+  }
+  close(fds[1]);
+  bool ok = pid > 0 && read(fds[0], &report, sizeof(report)) == sizeof(report);
+  close(fds[0]);
+
+  int status = 0;
+  if (pid > 0)
+    waitpid(pid, &status, 0);
+  return ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+  // WeatherStruct and WaterStruct as they were, with a String per text
+typedef struct LegacyWeather {
+  String main;
+  String description;
+  String icon;
+  String period;
+} LegacyWeather;
+
+typedef struct LegacyWater {
+  String station;
+  String height_longname;
+  String height_unit;
+  String height_timestamp;
+  String height_stateMnwMhw;
+  String height_stateNswHsw;
+  String temp_longname;
+  String temp_unit;
+  String temp_timestamp;
+  String speed_longname;
+  String speed_unit;
+  String speed_timestamp;
+} LegacyWater;
+
+/* legacyStrings()
+    What the String members of the old structs allocated in a wake for the given data, filled the way the old
+    parsers did it (a String of each JSON value moved into the member)
+  Parameters:
+    size_t *bytes: set to the heap they took
+  Returns:
+    uint32_t: allocations
+*/
+static uint32_t legacyStrings(const WakeData &d, size_t *bytes) {
+  LegacyWeather weather;
+  LegacyWeather forecast[FORECAST_COUNT];
+  LegacyWater water;
+  size_t before = hostHeapStats().in_use;
+
+  hostHeapReset();
+  weather.main = String(d.main);
+  weather.description = String(d.description);
+  weather.icon = String(d.icon);
+  for (int i = 0; i < FORECAST_COUNT; i++) {
+    time_t dt = FORECAST_START + i * 3 * 3600;
+    char dt_txt[20];
+    strftime(dt_txt, sizeof(dt_txt), "%Y-%m-%d %H:%M:%S", gmtime(&dt));
+    forecast[i].icon = String(d.icon);
+    forecast[i].main = String(d.main);
+    forecast[i].description = String(d.description);
+    forecast[i].period = String(dt_txt);
+  }
+  water.station = String(d.station);
+  water.height_longname = String(d.longname[0]);
+  water.height_unit = String(d.unit[0]);
+  water.height_timestamp = String(d.timestamp);
+  water.height_stateMnwMhw = String(d.state);
+  water.height_stateNswHsw = String(d.state);
+  water.temp_longname = String(d.longname[1]);
+  water.temp_unit = String(d.unit[1]);
+  water.temp_timestamp = String(d.timestamp);
+  water.speed_longname = String(d.longname[2]);
+  water.speed_unit = String(d.unit[2]);
+  water.speed_timestamp = String(d.timestamp);
+
+  HostHeapStats heap = hostHeapStats();
+  *bytes = heap.in_use - before;
+  return heap.allocations;
+}
+
+static void checkWake(const char *name, const WakeData &d, WakeReport &report) {
+  char message[96];
+  size_t legacy_bytes;
+
+  snprintf(message, sizeof(message), "%s: the wake didn't end in deep sleep", name);
+  TEST_ASSERT_TRUE_MESSAGE(runWake(d, report), message);
+  uint32_t legacy = legacyStrings(d, &legacy_bytes);
+
+  printf("Wake, %s: %lu allocations, %u bytes peak heap, %lu requests, sleeping %lu s. The String members of the "
+         "old structs would add %lu allocations (%u bytes)\n", name, (unsigned long)report.allocations,
+         (unsigned)report.peak, (unsigned long)report.requests, (unsigned long)(report.sleep_us / 1000000),
+         (unsigned long)legacy, (unsigned)legacy_bytes);
+
+  snprintf(message, sizeof(message), "%s: %lu requests answered, %d expected", name, (unsigned long)report.requests,
+           WAKE_REQUESTS);
+  TEST_ASSERT_TRUE_MESSAGE(report.requests == WAKE_REQUESTS, message);
+  TEST_ASSERT_TRUE_MESSAGE(report.refreshed, "the panel wasn't refreshed");
+}
+
+void test_wake_allocations(void) {
+  WakeReport short_wake, long_wake;
+
+  checkWake("short texts", short_texts, short_wake);
+  checkWake("long texts", long_texts, long_wake);
+
+  char message[96];
+  snprintf(message, sizeof(message), "%lu allocations with the long texts, %lu with the short ones",
+           (unsigned long)long_wake.allocations, (unsigned long)short_wake.allocations);
+  TEST_ASSERT_TRUE_MESSAGE(long_wake.allocations == short_wake.allocations, message);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_wake_allocations);
+  return UNITY_END();
+}
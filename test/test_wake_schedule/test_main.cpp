@@ -0,0 +1,187 @@
+/* Unit tests of the WakeSchedule library on the host: which SleepPolicy the time of day picks, how a shorter
+    policy cuts the interval of the current one short, how the wake is aligned to the next publication of the
+    source that runs out first, and the drift correction of the clock. Times are UTC, the local time passed in is
+    gmtime() of now.
+
+    pio test -e native -f test_wake_schedule
+*/
+
+#include <unity.h>
+#include "wakeSchedule.h"
+
+const time_t MINUTE = 60;
+const time_t HOUR = 60 * MINUTE;
+const time_t MIDNIGHT = 1709251200;     // 2024-03-01 00:00:00 UTC
+
+  // The policies of main.cpp: power saving at night, every 30 minutes from 06:00 to 23:00
+const SleepPolicy policies[] = {
+  {0, 120},
+  {6, 30},
+  {23, 120}
+};
+const int POLICY_COUNT = sizeof(policies) / sizeof(policies[0]);
+
+  // Without a policy from midnight, the one of the evening runs on until the morning
+const SleepPolicy day_only[] = {
+  {6, 30},
+  {23, 120}
+};
+const int DAY_ONLY_COUNT = sizeof(day_only) / sizeof(day_only[0]);
+
+  // The sources of main.cpp: name, data, size, ttl, period, delay
+const CacheSource sources[] = {
+  {"weather", NULL, 0, 10 * MINUTE, 10 * MINUTE, 1 * MINUTE},
+  {"forecast", NULL, 0, 3 * HOUR, 3 * HOUR, 10 * MINUTE},
+  {"water", NULL, 0, 15 * MINUTE, 15 * MINUTE, 5 * MINUTE}
+};
+const int SOURCE_COUNT = sizeof(sources) / sizeof(sources[0]);
+
+static CacheStruct cache[SOURCE_COUNT];
+
+  // Every source fetched at the given time
+static void fetchedAt(time_t fetched) {
+  memset(cache, 0, sizeof(cache));
+  for (int i = 0; i < SOURCE_COUNT; i++)
+    cache[i].fetched = fetched;
+}
+
+  // Wake time for the first source_count sources, the policy checks look at the weather alone, which is published a
+  // minute past every 10 minutes
+static time_t wakeAt(time_t now, const SleepPolicy *table, int count, int source_count = 1) {
+  struct tm local;
+  gmtime_r(&now, &local);
+  return nextWakeTime(now, local, table, count, cache, sources, source_count);
+}
+
+void test_day_policy_interval(void) {
+  time_t now = MIDNIGHT + 10 * HOUR;
+  fetchedAt(now);
+
+  // 30 minutes from now is 10:30, the weather is next published at 10:31
+  TEST_ASSERT_EQUAL(now + 31 * MINUTE, wakeAt(now, policies, POLICY_COUNT));
+  // the water level at 10:35 and the forecast at 13:10 are later than that
+  TEST_ASSERT_EQUAL(now + 31 * MINUTE, wakeAt(now, policies, POLICY_COUNT, SOURCE_COUNT));
+}
+
+void test_night_policy_interval(void) {
+  time_t now = MIDNIGHT + 2 * HOUR + 17 * MINUTE;
+  fetchedAt(now);
+
+  // 120 minutes from 02:17 is 04:17, the weather is next published at 04:21
+  TEST_ASSERT_EQUAL(MIDNIGHT + 4 * HOUR + 21 * MINUTE, wakeAt(now, policies, POLICY_COUNT));
+}
+
+void test_evening_policy_past_midnight(void) {
+  time_t now = MIDNIGHT + 23 * HOUR + 50 * MINUTE;
+  fetchedAt(now);
+
+  // the policy from 23:00 and the one from midnight have the same interval, 01:50 and published at 01:51
+  TEST_ASSERT_EQUAL(MIDNIGHT + 25 * HOUR + 51 * MINUTE, wakeAt(now, policies, POLICY_COUNT));
+}
+
+void test_last_policy_before_first_start(void) {
+  time_t now = MIDNIGHT + 3 * HOUR;
+  fetchedAt(now);
+
+  // before 06:00 the policy from 23:00 is still running: 05:00, not 03:30
+  TEST_ASSERT_EQUAL(MIDNIGHT + 5 * HOUR + 1 * MINUTE, wakeAt(now, day_only, DAY_ONLY_COUNT));
+}
+
+void test_shorter_policy_cuts_interval(void) {
+  time_t now = MIDNIGHT + 5 * HOUR + 20 * MINUTE + 30;
+  fetchedAt(now);
+
+  // 120 minutes would be 07:20:30, the day policy starts at 06:00 and wakes at its first publication
+  TEST_ASSERT_EQUAL(MIDNIGHT + 6 * HOUR + 1 * MINUTE, wakeAt(now, policies, POLICY_COUNT));
+}
+
+void test_longer_policy_does_not_cut(void) {
+  time_t now = MIDNIGHT + 22 * HOUR + 45 * MINUTE;
+  fetchedAt(now);
+
+  // the night policy from 23:00 has the longer interval, the day interval runs to 23:15 and 23:21
+  TEST_ASSERT_EQUAL(MIDNIGHT + 23 * HOUR + 21 * MINUTE, wakeAt(now, policies, POLICY_COUNT));
+}
+
+void test_fresh_cache_waits_for_ttl(void) {
+  time_t now = MIDNIGHT + 10 * HOUR;
+  fetchedAt(now);
+
+  // on its own the forecast, fetched just now, is due at 13:00, after the publication at 12:10, so it waits for
+  // the one at 15:10
+  struct tm local;
+  gmtime_r(&now, &local);
+  time_t wake = nextWakeTime(now, local, policies, POLICY_COUNT, &cache[1], &sources[1], 1);
+  TEST_ASSERT_EQUAL(MIDNIGHT + 15 * HOUR + 10 * MINUTE, wake);
+}
+
+void test_stale_cache_wakes_after_interval(void) {
+  time_t now = MIDNIGHT + 10 * HOUR;
+  fetchedAt(now - 6 * HOUR);
+
+  // run out long ago, the forecast is due after the 30 minute interval and published at 12:10
+  struct tm local;
+  gmtime_r(&now, &local);
+  time_t wake = nextWakeTime(now, local, policies, POLICY_COUNT, &cache[1], &sources[1], 1);
+  TEST_ASSERT_EQUAL(MIDNIGHT + 12 * HOUR + 10 * MINUTE, wake);
+}
+
+void test_never_fetched(void) {
+  time_t now = MIDNIGHT + 10 * HOUR;
+  fetchedAt(0);
+
+  TEST_ASSERT_EQUAL(now + 31 * MINUTE, wakeAt(now, policies, POLICY_COUNT, SOURCE_COUNT));
+}
+
+void test_earliest_source_wins(void) {
+  time_t now = MIDNIGHT + 10 * HOUR + 2 * MINUTE;
+  fetchedAt(now);
+  cache[0].fetched = now + 2 * HOUR;      // weather fresh for another two hours
+
+  // the water level is due at 10:32 and published at 10:35, before the weather at 12:21
+  TEST_ASSERT_EQUAL(MIDNIGHT + 10 * HOUR + 35 * MINUTE, wakeAt(now, policies, POLICY_COUNT, SOURCE_COUNT));
+}
+
+void test_due_on_publication(void) {
+  time_t now = MIDNIGHT + 10 * HOUR + 1 * MINUTE;
+  fetchedAt(now);
+
+  // due at 10:31, which is a publication of the weather, no extra period
+  TEST_ASSERT_EQUAL(now + 30 * MINUTE, wakeAt(now, policies, POLICY_COUNT));
+}
+
+void test_corrected_time(void) {
+  const double ref = MIDNIGHT;
+
+  TEST_ASSERT_DOUBLE_WITHIN(1e-6, ref + 1e6 + 100, correctedTime(ref + 1e6, MIDNIGHT, 100));   // RTC slow
+  TEST_ASSERT_DOUBLE_WITHIN(1e-6, ref + 1e6 - 50, correctedTime(ref + 1e6, MIDNIGHT, -50));    // RTC fast
+  TEST_ASSERT_DOUBLE_WITHIN(1e-6, ref + 3600.25, correctedTime(ref + 3600.25, MIDNIGHT, 0));
+}
+
+void test_corrected_time_without_reference(void) {
+  const double clock = MIDNIGHT + 0.5;
+
+  TEST_ASSERT_DOUBLE_WITHIN(1e-6, clock, correctedTime(clock, 0, 100));                // clock never set
+  TEST_ASSERT_DOUBLE_WITHIN(1e-6, clock, correctedTime(clock, MIDNIGHT + 60, 100));    // clock set after it
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_day_policy_interval);
+  RUN_TEST(test_night_policy_interval);
+  RUN_TEST(test_evening_policy_past_midnight);
+  RUN_TEST(test_last_policy_before_first_start);
+  RUN_TEST(test_shorter_policy_cuts_interval);
+  RUN_TEST(test_longer_policy_does_not_cut);
+  RUN_TEST(test_fresh_cache_waits_for_ttl);
+  RUN_TEST(test_stale_cache_wakes_after_interval);
+  RUN_TEST(test_never_fetched);
+  RUN_TEST(test_earliest_source_wins);
+  RUN_TEST(test_due_on_publication);
+  RUN_TEST(test_corrected_time);
+  RUN_TEST(test_corrected_time_without_reference);
+  return UNITY_END();
+}
@@ -0,0 +1,137 @@
+/* What a wake receives from pegelonline, the old way and the way fetchPegelonline() does it now, on the scripted
+    network of [env:native]. The responses are the recorded bodies of waterFixtures.h behind the same HTTP header:
+      old: the whole station with includeTimeseries and includeCurrentMeasurement, parsed by parseStation()
+      new: getTodaysWater() on a station whose names are known, the currentmeasurement of W, WT and Q pipelined
+    Prints the bytes received (headers and bodies, HttpsSession.received) and the time of each wake, and fails if the
+    new way receives as much as the old one:
+
+    pio test -e native -f test_water_fetch -v
+*/
+
+#include <Arduino.h>
+#include <unity.h>
+#include "hostNet.h"
+#include "httpsSession.h"
+#include "waterFixtures.h"
+#include "weatherData.h"
+
+bool parseStation(Stream &in, WaterStruct &out);
+bool getTodaysWater(HttpsSession &http);
+extern WaterStruct water[];
+
+const char *const HOST = "www.pegelonline.wsv.de";
+const char *const OLD_PATH = "/webservices/rest-api/v2/stations/" WATER_FIXTURE_STATION
+                             ".json?includeTimeseries=true&includeCurrentMeasurement=true";
+const int SERIES_COUNT = sizeof(WATER_MEASUREMENT_FIXTURES) / sizeof(WATER_MEASUREMENT_FIXTURES[0]);
+const int WAKES = 5;                    // the fastest of these counts, timing on a PC is noisy
+
+static char station_response[4 * 1024];
+static char measurement_responses[SERIES_COUNT][512];
+static size_t station_len;
+static size_t measurement_len[SERIES_COUNT];
+
+typedef struct Wake {
+  bool ok;
+  uint32_t received;    // HttpsSession.received of the wake
+  uint32_t us;          // fastest wake
+} Wake;
+
+static Wake old_wake;
+static Wake new_wake;
+
+/* buildResponse()
+    An HTTP response carrying body, with the header pegelonline answers with
+  Returns:
+    size_t: length of the response, 0 if it doesn't fit in out
+*/
+static size_t buildResponse(char *out, size_t size, const char *body) {
+  int len = snprintf(out, size,
+                     "HTTP/1.1 200 OK\r\nDate: Tue, 10 Sep 2024 20:20:00 GMT\r\nServer: Apache\r\n"
+                     "Content-Type: application/json\r\nContent-Length: %u\r\n\r\n%s", (unsigned)strlen(body), body);
+  return len > 0 && (size_t)len < size ? len : 0;
+}
+
+  // One wake the old way: a single request for the whole station
+static Wake fetchOld(void) {
+  Wake wake = {false, 0, UINT32_MAX};
+
+  for (int i = 0; i < WAKES; i++) {
+    hostNetReset();
+    hostNetReply(HOST, station_response, station_len);
+
+    uint32_t start = micros();
+    HttpsSession http(HOST);
+    WaterStruct parsed;
+    wake.ok = http.get(OLD_PATH) && http.status == 200 && parseStation(http, parsed);
+    http.finish();
+    uint32_t us = micros() - start;
+
+    wake.received = http.received;
+    wake.us = min(wake.us, us);
+    http.stop();
+  }
+  return wake;
+}
+
+  // One wake the way fetchPegelonline() does it, the station's names known from an earlier wake
+static Wake fetchNew(void) {
+  Wake wake = {false, 0, UINT32_MAX};
+
+  for (int i = 0; i < WAKES; i++) {
+    hostNetReset();
+    for (int s = 0; s < SERIES_COUNT; s++)
+      hostNetReply(HOST, measurement_responses[s], measurement_len[s]);
+    water[0] = WaterStruct();
+    strcpy(water[0].station, "KONSTANZ");
+
+    uint32_t start = micros();
+    HttpsSession http(HOST);
+    wake.ok = getTodaysWater(http);
+    uint32_t us = micros() - start;
+
+    wake.received = http.received;
+    wake.us = min(wake.us, us);
+    http.stop();
+  }
+  return wake;
+}
+
+void test_old_wake(void) {
+  TEST_ASSERT_TRUE_MESSAGE(old_wake.ok, "the station didn't parse");
+}
+
+void test_new_wake(void) {
+  TEST_ASSERT_TRUE_MESSAGE(new_wake.ok, "getTodaysWater() failed");
+  TEST_ASSERT_EQUAL_FLOAT(341.0, water[0].height);
+  TEST_ASSERT_EQUAL_FLOAT(19.4, water[0].temp);
+  TEST_ASSERT_EQUAL_FLOAT(312.0, water[0].speed);
+}
+
+void test_received_per_wake(void) {
+  printf("pegelonline per wake, best of %d:\n", WAKES);
+  printf("  old: station with its current measurements   %5lu bytes received  %6lu us  %s\n",
+         (unsigned long)old_wake.received, (unsigned long)old_wake.us, old_wake.ok ? "ok" : "FAILED");
+  printf("  new: %d currentmeasurement requests           %5lu bytes received  %6lu us  %s\n", SERIES_COUNT,
+         (unsigned long)new_wake.received, (unsigned long)new_wake.us, new_wake.ok ? "ok" : "FAILED");
+
+  TEST_ASSERT_TRUE_MESSAGE(new_wake.received > 0, "nothing received the new way");
+  TEST_ASSERT_TRUE_MESSAGE(new_wake.received < old_wake.received, "the new way receives no less than the old");
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  station_len = buildResponse(station_response, sizeof(station_response), WATER_FIXTURE);
+  for (int s = 0; s < SERIES_COUNT; s++)
+    measurement_len[s] = buildResponse(measurement_responses[s], sizeof(measurement_responses[s]),
+                                       WATER_MEASUREMENT_FIXTURES[s]);
+  old_wake = fetchOld();
+  new_wake = fetchNew();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_old_wake);
+  RUN_TEST(test_new_wake);
+  RUN_TEST(test_received_per_wake);
+  return UNITY_END();
+}
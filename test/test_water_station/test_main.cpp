@@ -0,0 +1,151 @@
+/* The streaming station parser of main.cpp on the recorded KONSTANZ station of waterFixtures.h, whose series come in
+    a different order than the live station: W, WT and Q have to be picked by their shortname, wherever they are, and
+    a series the station doesn't have is left empty. Also prints the time parseStation() takes against a whole
+    DynamicJsonDocument of the station (the parse before), for information only:
+
+    pio test -e native -f test_water_station -v
+*/
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <unity.h>
+#include "waterFixtures.h"
+#include "weatherData.h"
+
+bool parseStation(Stream &in, WaterStruct &out);
+
+const int ROUNDS = 200;                 // parses timed in a row...
+const int RUNS = 5;                     // ...the fastest of these runs counts, timing on a PC is noisy
+const size_t DOCUMENT_BYTES = 20 * 1024;  // the DynamicJsonDocument of the old parse
+
+  // Stream over a string in memory
+class MemoryStream : public Stream {
+public:
+  MemoryStream(const char *data, size_t len) : data(data), len(len), pos(0) {}
+  int available() override { return len - pos; }
+  int read() override { return pos < len ? (uint8_t)data[pos++] : -1; }
+  int peek() override { return pos < len ? (uint8_t)data[pos] : -1; }
+  size_t write(uint8_t) override { return 0; }
+
+private:
+  const char *data;
+  size_t len;
+  size_t pos;
+};
+
+static WaterStruct parsed;
+static bool parsed_ok;
+
+  // The fixture without its Q series, the entry from {"shortname":"Q" up to the next one
+static char without_q[sizeof(WATER_FIXTURE)];
+
+static size_t removeDischarge(void) {
+  const char *q = strstr(WATER_FIXTURE, "{\"shortname\":\"Q\"");
+  const char *next = q ? strstr(q + 1, "{\"shortname\":") : NULL;
+  if (next == NULL)
+    return 0;
+  size_t head = q - WATER_FIXTURE;
+  memcpy(without_q, WATER_FIXTURE, head);
+  strcpy(without_q + head, next);
+  return strlen(without_q);
+}
+
+void test_station_parses(void) {
+  TEST_ASSERT_TRUE(parsed_ok);
+  TEST_ASSERT_EQUAL_STRING("KONSTANZ", parsed.station);
+}
+
+void test_height_by_shortname(void) {
+  TEST_ASSERT_EQUAL_FLOAT(341.0, parsed.height);
+  TEST_ASSERT_EQUAL_STRING("WASSERSTAND ROHDATEN", parsed.height_longname);
+  TEST_ASSERT_EQUAL_STRING("cm", parsed.height_unit);
+  TEST_ASSERT_EQUAL_STRING("2024-09-10T22:15:00+02:00", parsed.height_timestamp);
+  TEST_ASSERT_EQUAL(WATER_STATE_NORMAL, parsed.height_stateMnwMhw);
+  TEST_ASSERT_EQUAL(WATER_STATE_NORMAL, parsed.height_stateNswHsw);
+}
+
+  // WT comes first and LT, the air temperature in the same unit, after it
+void test_temperature_by_shortname(void) {
+  TEST_ASSERT_EQUAL_FLOAT(19.4, parsed.temp);
+  TEST_ASSERT_EQUAL_STRING("WASSERTEMPERATUR", parsed.temp_longname);
+  TEST_ASSERT_EQUAL_STRING("°C", parsed.temp_unit);
+  TEST_ASSERT_EQUAL_STRING("2024-09-10T22:15:00+02:00", parsed.temp_timestamp);
+}
+
+  // Q comes after VA, a speed in m/s
+void test_discharge_by_shortname(void) {
+  TEST_ASSERT_EQUAL_FLOAT(312.0, parsed.speed);
+  TEST_ASSERT_EQUAL_STRING("ABFLUSS", parsed.speed_longname);
+  TEST_ASSERT_EQUAL_STRING("m³/s", parsed.speed_unit);
+  TEST_ASSERT_EQUAL_STRING("2024-09-10T22:15:00+02:00", parsed.speed_timestamp);
+}
+
+void test_missing_series_left_empty(void) {
+  size_t len = removeDischarge();
+  WaterStruct out;
+
+  TEST_ASSERT_TRUE_MESSAGE(len > 0, "no Q series in the fixture");
+  MemoryStream in(without_q, len);
+  TEST_ASSERT_TRUE(parseStation(in, out));
+  TEST_ASSERT_EQUAL_FLOAT(341.0, out.height);
+  TEST_ASSERT_EQUAL_FLOAT(19.4, out.temp);
+  TEST_ASSERT_EQUAL_FLOAT(0, out.speed);
+  TEST_ASSERT_EQUAL_STRING("", out.speed_longname);
+  TEST_ASSERT_EQUAL_STRING("", out.speed_unit);
+  TEST_ASSERT_EQUAL_STRING("", out.speed_timestamp);
+}
+
+/* timeParse()
+    Parses the fixture ROUNDS times, streaming or into a whole document
+  Returns:
+    uint32_t: microseconds the fastest of RUNS runs took
+*/
+static uint32_t timeParse(bool streaming, size_t *document_used) {
+  uint32_t best = UINT32_MAX;
+
+  for (int run = 0; run < RUNS; run++) {
+    uint32_t start = micros();
+    for (int r = 0; r < ROUNDS; r++) {
+      MemoryStream in(WATER_FIXTURE, strlen(WATER_FIXTURE));
+      if (streaming) {
+        WaterStruct out;
+        parseStation(in, out);
+      } else {
+        DynamicJsonDocument doc(DOCUMENT_BYTES);
+        deserializeJson(doc, in);
+        *document_used = doc.memoryUsage();
+      }
+    }
+    uint32_t us = micros() - start;
+    best = min(best, us);
+  }
+  return best;
+}
+
+void test_parse_time(void) {
+  size_t document_used = 0;
+  uint32_t streaming_us = timeParse(true, NULL);
+  uint32_t document_us = timeParse(false, &document_used);
+
+  printf("Station of %u bytes x%d, best of %d:\n", (unsigned)strlen(WATER_FIXTURE), ROUNDS, RUNS);
+  printf("  parseStation()        %8.1f us per parse\n", streaming_us / (double)ROUNDS);
+  printf("  DynamicJsonDocument   %8.1f us per parse, %u of %u bytes used\n", document_us / (double)ROUNDS,
+         (unsigned)document_used, (unsigned)DOCUMENT_BYTES);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  MemoryStream in(WATER_FIXTURE, strlen(WATER_FIXTURE));
+  parsed_ok = parseStation(in, parsed);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_station_parses);
+  RUN_TEST(test_height_by_shortname);
+  RUN_TEST(test_temperature_by_shortname);
+  RUN_TEST(test_discharge_by_shortname);
+  RUN_TEST(test_missing_series_left_empty);
+  RUN_TEST(test_parse_time);
+  return UNITY_END();
+}